@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BenchmarkInputs.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Deterministic synthetic inputs shared by the benchmarks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if !defined BenchmarkInputs_h
+/** Prevents repeated inclusion of headers. */
+#define BenchmarkInputs_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace benchmarks
+  {
+    /**
+     * @param size the side of the domain.
+     * @return the domain [0,size-1]^3.
+     */
+    inline Z3i::Domain cube( int size )
+    {
+      return Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+    }
+
+    /**
+     * @param size the side of the domain.
+     * @return the Euclidean ball of diameter size-4 centered in cube( size ).
+     */
+    inline Z3i::DigitalSet ball( int size )
+    {
+      Z3i::DigitalSet set( cube( size ) );
+      Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( size / 2 ), size / 2 - 2 );
+      return set;
+    }
+
+    /**
+     * The Goursat surface x^4+y^4+z^4-5(x^2+y^2+z^2)+11.8=0 (a cube
+     * with rounded edges and holes), digitized with size points along
+     * each axis.
+     */
+    class Goursat
+    {
+    public:
+      typedef Z3i::Space::RealPoint RealPoint;
+      typedef MPolynomial<3, RealPoint::Coordinate> Polynomial;
+      typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+      typedef GaussDigitizer<Z3i::Space, Shape> Digitizer;
+
+      /**
+       * Constructor.
+       * @param size the number of grid points along each axis.
+       */
+      explicit Goursat( int size )
+        : myShape( polynomial() )
+      {
+        myH = 5.0 / size;
+        myDigitizer.attach( myShape );
+        myDigitizer.init( RealPoint::diagonal( -2.5 ), RealPoint::diagonal( 2.5 ), myH );
+        myK.init( myDigitizer.getLowerBound(), myDigitizer.getUpperBound(), true );
+      }
+
+      /// @return the polynomial of the surface.
+      static Polynomial polynomial()
+      {
+        Polynomial P;
+        const std::string str = "x^4+y^4+z^4-5*x^2-5*y^2-5*z^2+11.8";
+        MPolynomialReader<3, RealPoint::Coordinate>().read( P, str.begin(), str.end() );
+        return P;
+      }
+
+      /// @return the digitized shape (a point predicate).
+      const Digitizer & digitizer() const { return myDigitizer; }
+      /// @return the Khalimsky space of the digitization.
+      const Z3i::KSpace & space() const { return myK; }
+      /// @return the grid step.
+      double h() const { return myH; }
+
+      /// @return the digital points of the shape.
+      Z3i::DigitalSet set() const
+      {
+        Z3i::DigitalSet set( myDigitizer.getDomain() );
+        Shapes<Z3i::Domain>::digitalShaper( set, myDigitizer );
+        return set;
+      }
+
+      /// @return the surfels of the boundary component of a bel.
+      std::vector<Z3i::SCell> surfels() const
+      {
+        Z3i::KSpace::SCellSet surface;
+        const Z3i::SCell bel = Surfaces<Z3i::KSpace>::findABel( myK, myDigitizer, 100000 );
+        Surfaces<Z3i::KSpace>::trackBoundary( surface, myK, SurfelAdjacency<3>( true ),
+                                              myDigitizer, bel );
+        return std::vector<Z3i::SCell>( surface.begin(), surface.end() );
+      }
+
+    private:
+      Shape myShape;
+      Digitizer myDigitizer;
+      Z3i::KSpace myK;
+      double myH;
+
+      Goursat( const Goursat & other );
+      Goursat & operator= ( const Goursat & other );
+    };
+
+    /**
+     * @param radius the mean radius of the flower.
+     * @return the digitization (grid step 1) of a flower with 5 petals.
+     */
+    inline Z2i::DigitalSet flower( double radius )
+    {
+      typedef Flower2D<Z2i::Space> Shape;
+      Shape shape( Z2i::RealPoint( 0.0, 0.0 ), radius, radius / 3.0, 5, 0.5 );
+      GaussDigitizer<Z2i::Space, Shape> digitizer;
+      digitizer.attach( shape );
+      digitizer.init( shape.getLowerBound() - Z2i::RealPoint( 2.0, 2.0 ),
+                      shape.getUpperBound() + Z2i::RealPoint( 2.0, 2.0 ), 1.0 );
+      Z2i::DigitalSet set( digitizer.getDomain() );
+      Shapes<Z2i::Domain>::digitalShaper( set, digitizer );
+      return set;
+    }
+
+    /**
+     * @param radius the mean radius of the flower.
+     * @return the 4-connected contour of flower( radius ).
+     */
+    inline std::vector<Z2i::Point> flowerContour( double radius )
+    {
+      const Z2i::DigitalSet set = flower( radius );
+      Z2i::KSpace K;
+      K.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+      const Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, set, 100000 );
+      std::vector<Z2i::Point> contour;
+      Surfaces<Z2i::KSpace>::track2DBoundaryPoints( contour, K, SurfelAdjacency<2>( true ),
+                                                    set, bel );
+      return contour;
+    }
+
+    /**
+     * @param diameter the half-side of the square of points.
+     * @return the points of the naive plane 0 <= 5x+7y+37z < 37 whose
+     * x and y lie in [-diameter,diameter), in raster order.
+     */
+    inline std::vector<Z3i::Point> planePoints( int diameter )
+    {
+      std::vector<Z3i::Point> points;
+      for ( int y = -diameter; y < diameter; ++y )
+        for ( int x = -diameter; x < diameter; ++x )
+          {
+            // z = ceil( -(5x+7y) / 37 )
+            const int num = -( 5 * x + 7 * y );
+            const int z = ( num >= 0 ) ? ( num + 36 ) / 37 : -( ( -num ) / 37 );
+            points.push_back( Z3i::Point( x, y, z ) );
+          }
+      return points;
+    }
+
+  } // namespace benchmarks
+} // namespace DGtal
+
+#endif // !defined BenchmarkInputs_h
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
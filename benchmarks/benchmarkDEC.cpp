@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDEC.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the assembly of discrete exterior calculus structures and operators.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/MatrixFreeLaplaceSolver.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus2D;
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus3D;
+
+static void BM_CreateFromDigitalSet2D(benchmark::State& state)
+{
+  const Z2i::DigitalSet set = benchmarks::flower( state.range(0) );
+  while (state.KeepRunning())
+    {
+      const Calculus2D calculus = CalculusFactory::createFromDigitalSet( set );
+      benchmark::DoNotOptimize( calculus.kFormLength( 0, PRIMAL ) );
+    }
+  state.SetItemsProcessed(state.iterations() * set.size());
+}
+BENCHMARK(BM_CreateFromDigitalSet2D)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_CreateFromDigitalSet3D(benchmark::State& state)
+{
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  while (state.KeepRunning())
+    {
+      const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set );
+      benchmark::DoNotOptimize( calculus.kFormLength( 0, PRIMAL ) );
+    }
+  state.SetItemsProcessed(state.iterations() * set.size());
+}
+BENCHMARK(BM_CreateFromDigitalSet3D)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+static void BM_Laplace2D(benchmark::State& state)
+{
+  const Z2i::DigitalSet set = benchmarks::flower( state.range(0) );
+  const Calculus2D calculus = CalculusFactory::createFromDigitalSet( set );
+  while (state.KeepRunning())
+    {
+      const Calculus2D::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+      benchmark::DoNotOptimize( laplace.myContainer.nonZeros() );
+    }
+  state.SetItemsProcessed(state.iterations() * calculus.kFormLength( 0, PRIMAL ));
+}
+BENCHMARK(BM_Laplace2D)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_Laplace3D(benchmark::State& state)
+{
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set );
+  while (state.KeepRunning())
+    {
+      const Calculus3D::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+      benchmark::DoNotOptimize( laplace.myContainer.nonZeros() );
+    }
+  state.SetItemsProcessed(state.iterations() * calculus.kFormLength( 0, PRIMAL ));
+}
+BENCHMARK(BM_Laplace3D)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+static void BM_SolvePoissonLDLT3D(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus3D, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> Solver;
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set, true );
+  const Calculus3D::DualForm0 input = Calculus3D::DualForm0::ones( calculus );
+  while (state.KeepRunning())
+    {
+      Solver solver;
+      solver.compute( calculus.laplace<DUAL>() );
+      const Calculus3D::DualForm0 solution = solver.solve( input );
+      benchmark::DoNotOptimize( solution.myContainer.data() );
+    }
+  state.SetItemsProcessed(state.iterations() * calculus.kFormLength( 0, DUAL ));
+}
+BENCHMARK(BM_SolvePoissonLDLT3D)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+static void BM_SolvePoissonMatrixFree3D(benchmark::State& state)
+{
+  typedef MatrixFreeLaplaceSolver<Calculus3D, DUAL> Solver;
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set, true );
+  const Calculus3D::DualForm0 input = Calculus3D::DualForm0::ones( calculus );
+  while (state.KeepRunning())
+    {
+      const Solver::Operator laplacian( calculus );
+      Solver solver;
+      solver.compute( laplacian );
+      const Calculus3D::DualForm0 solution = solver.solve( input );
+      benchmark::DoNotOptimize( solution.myContainer.data() );
+    }
+  state.SetItemsProcessed(state.iterations() * calculus.kFormLength( 0, DUAL ));
+}
+BENCHMARK(BM_SolvePoissonMatrixFree3D)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+static void BM_HeatSources2D(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus2D, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> Solver;
+  const Z2i::DigitalSet set = benchmarks::flower( 64 );
+  const Calculus2D calculus = CalculusFactory::createFromDigitalSet( set, true );
+  const Calculus2D::DualIdentity0 heat = calculus.identity<0, DUAL>() + calculus.laplace<DUAL>();
+  Solver solver;
+  solver.compute( heat );
+  const Calculus2D::Index length = calculus.kFormLength( 0, DUAL );
+  const Calculus2D::Index nb_sources = 32;
+  Calculus2D::DenseMatrix sources = Calculus2D::DenseMatrix::Zero( length, nb_sources );
+  for ( Calculus2D::Index kk = 0; kk < nb_sources; kk++ )
+    sources( kk * length / nb_sources, kk ) = 1;
+  Calculus2D::DenseMatrix solutions;
+  Calculus2D::DualForm0 solution( calculus );
+  while (state.KeepRunning())
+    {
+      if ( state.range(0) == 1 )
+        solver.solve( sources, solutions );
+      else
+        for ( Calculus2D::Index kk = 0; kk < nb_sources; kk++ )
+          solver.solve( Calculus2D::DualForm0( calculus, sources.col( kk ) ), solution );
+      benchmark::DoNotOptimize( solution.myContainer.data() );
+    }
+  state.SetItemsProcessed(state.iterations() * nb_sources);
+}
+BENCHMARK(BM_HeatSources2D)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDistanceTransformation.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the separable distance transformations, of VoronoiMap and of the fast marching method.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+
+static void BM_DistanceTransformation(benchmark::State& state)
+{
+  const Z3i::Domain domain = benchmarks::cube( state.range(0) );
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  const L2Metric l2;
+  while (state.KeepRunning())
+    {
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2 );
+      benchmark::DoNotOptimize( dt( domain.lowerBound() ) );
+    }
+  state.SetItemsProcessed(state.iterations() * domain.size());
+}
+BENCHMARK(BM_DistanceTransformation)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_VoronoiMap(benchmark::State& state)
+{
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> Sites;
+  const Z3i::Domain domain = benchmarks::cube( state.range(0) );
+  // One site every 8 voxels along each axis.
+  Z3i::DigitalSet set( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( (*it)[ 0 ] % 8 ) != 0 || ( (*it)[ 1 ] % 8 ) != 0 || ( (*it)[ 2 ] % 8 ) != 0 )
+      set.insertNew( *it );
+  const Sites sites( set );
+  const L2Metric l2;
+  while (state.KeepRunning())
+    {
+      VoronoiMap<Z3i::Space, Sites, L2Metric> vm( domain, sites, l2 );
+      benchmark::DoNotOptimize( vm( domain.upperBound() ) );
+    }
+  state.SetItemsProcessed(state.iterations() * domain.size());
+}
+BENCHMARK(BM_VoronoiMap)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_FMM(benchmark::State& state)
+{
+  typedef ImageContainerBySTLMap<Z3i::Domain, double> Image;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef functors::DomainPredicate<Z3i::Domain> Predicate;
+  typedef FMM<Image, Set, Predicate> Fmm;
+  const Z3i::Domain domain = benchmarks::cube( state.range(0) );
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Z3i::KSpace::SCellSet bels;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( bels, K, set, domain.lowerBound(), domain.upperBound() );
+  const Predicate predicate( domain );
+  std::size_t nbPoints = 0;
+  while (state.KeepRunning())
+    {
+      Image map( domain );
+      Set accepted( map );
+      Fmm::initFromBelsRange( K, bels.begin(), bels.end(), map, accepted, 0.5 );
+      // The distances are computed in a band of width 4 around the surface.
+      Fmm fmm( map, accepted, predicate, domain.size(), 4.0 );
+      fmm.compute();
+      nbPoints = accepted.size();
+    }
+  state.SetItemsProcessed(state.iterations() * nbPoints);
+}
+BENCHMARK(BM_FMM)->RangeMultiplier(2)->Range(16, 64)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
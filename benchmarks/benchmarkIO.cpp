@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkIO.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the image and mesh readers and writers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/writers/PGMWriter.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/writers/MeshWriter.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+
+/// @return an image whose values are the distances to the center, modulo 256.
+Image3D rings( int size )
+{
+  Image3D image( benchmarks::cube( size ) );
+  const Z3i::Point center = Z3i::Point::diagonal( size / 2 );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itEnd = image.domain().end();
+        it != itEnd; ++it )
+    image.setValue( *it, (unsigned char) ( (*it - center).norm() * 8.0 ) );
+  return image;
+}
+
+/// @return the primal mesh of the boundary of benchmarks::ball( size ).
+Mesh<Z3i::RealPoint> ballMesh( int size )
+{
+  typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Boundary;
+  const Z3i::DigitalSet set = benchmarks::ball( size );
+  Z3i::KSpace K;
+  K.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+  const DigitalSurface<Boundary> surface( new Boundary( K, set ) );
+  Mesh<Z3i::RealPoint> mesh;
+  MeshHelpers::digitalSurface2PrimalMesh( surface, CanonicCellEmbedder<Z3i::KSpace>( K ), mesh );
+  return mesh;
+}
+
+static void BM_VolWriter(benchmark::State& state)
+{
+  const Image3D image = rings( state.range(0) );
+  const std::string filename = "benchmarkIO.vol";
+  while (state.KeepRunning())
+    VolWriter<Image3D>::exportVol( filename, image );
+  std::remove( filename.c_str() );
+  state.SetBytesProcessed(state.iterations() * image.domain().size());
+}
+BENCHMARK(BM_VolWriter)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_VolReader(benchmark::State& state)
+{
+  const Image3D image = rings( state.range(0) );
+  const std::string filename = "benchmarkIO.vol";
+  VolWriter<Image3D>::exportVol( filename, image );
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( VolReader<Image3D>::importVol( filename ) );
+  std::remove( filename.c_str() );
+  state.SetBytesProcessed(state.iterations() * image.domain().size());
+}
+BENCHMARK(BM_VolReader)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_PGM3DReader(benchmark::State& state)
+{
+  const Image3D image = rings( state.range(0) );
+  const std::string filename = "benchmarkIO.pgm3d";
+  PGMWriter<Image3D>::exportPGM3D( filename, image );
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( PGMReader<Image3D>::importPGM3D( filename ) );
+  std::remove( filename.c_str() );
+  state.SetBytesProcessed(state.iterations() * image.domain().size());
+}
+BENCHMARK(BM_PGM3DReader)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshWriterOFF(benchmark::State& state)
+{
+  const Mesh<Z3i::RealPoint> mesh = ballMesh( state.range(0) );
+  const std::string filename = "benchmarkIO.off";
+  while (state.KeepRunning())
+    {
+      std::ofstream out( filename.c_str() );
+      MeshWriter<Z3i::RealPoint>::export2OFF( out, mesh, false );
+    }
+  std::remove( filename.c_str() );
+  state.SetItemsProcessed(state.iterations() * mesh.nbFaces());
+}
+BENCHMARK(BM_MeshWriterOFF)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshReaderOFF(benchmark::State& state)
+{
+  const Mesh<Z3i::RealPoint> mesh = ballMesh( state.range(0) );
+  const std::string filename = "benchmarkIO.off";
+  {
+    std::ofstream out( filename.c_str() );
+    MeshWriter<Z3i::RealPoint>::export2OFF( out, mesh, false );
+  }
+  while (state.KeepRunning())
+    {
+      Mesh<Z3i::RealPoint> result;
+      MeshReader<Z3i::RealPoint>::importOFFFile( filename, result );
+    }
+  std::remove( filename.c_str() );
+  state.SetItemsProcessed(state.iterations() * mesh.nbFaces());
+}
+BENCHMARK(BM_MeshReaderOFF)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
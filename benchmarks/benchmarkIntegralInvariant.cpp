@@ -0,0 +1,92 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkIntegralInvariant.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the integral invariant curvature estimators.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MeanCurvatureFunctor;
+typedef IntegralInvariantVolumeEstimator<Z3i::KSpace, benchmarks::Goursat::Digitizer,
+                                         MeanCurvatureFunctor> MeanCurvatureEstimator;
+
+// Kernel radius 0.5 on the Goursat surface.
+static void BM_IIMeanCurvatureInit(benchmark::State& state)
+{
+  const benchmarks::Goursat goursat( state.range(0) );
+  const std::vector<Z3i::SCell> surfels = goursat.surfels();
+  MeanCurvatureFunctor functor;
+  functor.init( goursat.h(), 0.5 );
+  while (state.KeepRunning())
+    {
+      MeanCurvatureEstimator estimator( functor );
+      estimator.attach( goursat.space(), goursat.digitizer() );
+      estimator.setParams( 0.5 / goursat.h() );
+      estimator.init( goursat.h(), surfels.begin(), surfels.end() );
+    }
+}
+BENCHMARK(BM_IIMeanCurvatureInit)->RangeMultiplier(2)->Range(32, 64)->Unit(benchmark::kMillisecond);
+
+static void BM_IIMeanCurvatureEval(benchmark::State& state)
+{
+  const benchmarks::Goursat goursat( state.range(0) );
+  const std::vector<Z3i::SCell> surfels = goursat.surfels();
+  MeanCurvatureFunctor functor;
+  functor.init( goursat.h(), 0.5 );
+  MeanCurvatureEstimator estimator( functor );
+  estimator.attach( goursat.space(), goursat.digitizer() );
+  estimator.setParams( 0.5 / goursat.h() );
+  estimator.init( goursat.h(), surfels.begin(), surfels.end() );
+  std::vector<double> values;
+  while (state.KeepRunning())
+    {
+      values.clear();
+      estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( values ) );
+    }
+  state.SetItemsProcessed(state.iterations() * surfels.size());
+}
+BENCHMARK(BM_IIMeanCurvatureEval)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkPlaneRecognition.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the recognition of digital planes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef COBANaivePlaneComputer<Z3i::Space, DGtal::int64_t> COBAComputer;
+typedef ChordNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> ChordComputer;
+
+/// Initializes a plane recognition along the z-axis.
+void initPlane( COBAComputer & plane, int diameter )
+{
+  plane.init( 2, 2 * diameter, 1, 1 );
+}
+
+/// Initializes a plane recognition along the z-axis.
+void initPlane( ChordComputer & plane, int )
+{
+  plane.init( 2, 1, 1 );
+}
+
+template <typename Computer>
+static void BM_NaivePlaneRecognition(benchmark::State& state)
+{
+  const int diameter = state.range(0);
+  const std::vector<Z3i::Point> points = benchmarks::planePoints( diameter );
+  bool ok = true;
+  while (state.KeepRunning())
+    {
+      Computer plane;
+      initPlane( plane, diameter );
+      for ( std::vector<Z3i::Point>::const_iterator it = points.begin(), itEnd = points.end();
+            it != itEnd; ++it )
+        ok = plane.extend( *it ) && ok;
+    }
+  if ( ! ok ) state.SkipWithError( "plane not recognized" );
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK_TEMPLATE(BM_NaivePlaneRecognition, COBAComputer)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NaivePlaneRecognition, ChordComputer)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,105 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSegmentation.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the greedy and saturated segmentations of digital contours into DSSs.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef std::vector<Z2i::Point>::const_iterator ConstIterator;
+typedef ArithmeticalDSSComputer<ConstIterator, Z2i::Integer, 4> DSSComputer;
+
+static void BM_GreedySegmentation(benchmark::State& state)
+{
+  typedef GreedySegmentation<DSSComputer> Segmentation;
+  const std::vector<Z2i::Point> contour = benchmarks::flowerContour( state.range(0) );
+  std::size_t nbSegments = 0;
+  while (state.KeepRunning())
+    {
+      Segmentation segmentation( contour.begin(), contour.end(), DSSComputer() );
+      nbSegments = 0;
+      for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        ++nbSegments;
+    }
+  benchmark::DoNotOptimize( nbSegments );
+  state.SetItemsProcessed(state.iterations() * contour.size());
+}
+BENCHMARK(BM_GreedySegmentation)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_GreedySegmentationSegments(benchmark::State& state)
+{
+  typedef GreedySegmentation<DSSComputer> Segmentation;
+  const std::vector<Z2i::Point> contour = benchmarks::flowerContour( state.range(0) );
+  std::vector<DSSComputer> segments;
+  while (state.KeepRunning())
+    {
+      Segmentation segmentation( contour.begin(), contour.end(), DSSComputer() );
+      segmentation.segments( segments );
+    }
+  state.SetItemsProcessed(state.iterations() * contour.size());
+}
+BENCHMARK(BM_GreedySegmentationSegments)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_SaturatedSegmentation(benchmark::State& state)
+{
+  typedef SaturatedSegmentation<DSSComputer> Segmentation;
+  const std::vector<Z2i::Point> contour = benchmarks::flowerContour( state.range(0) );
+  std::size_t nbSegments = 0;
+  while (state.KeepRunning())
+    {
+      Segmentation segmentation( contour.begin(), contour.end(), DSSComputer() );
+      nbSegments = 0;
+      for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        ++nbSegments;
+    }
+  benchmark::DoNotOptimize( nbSegments );
+  state.SetItemsProcessed(state.iterations() * contour.size());
+}
+BENCHMARK(BM_SaturatedSegmentation)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
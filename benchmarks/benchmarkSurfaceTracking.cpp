@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSurfaceTracking.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the digital surface tracking and traversal.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+static void BM_TrackBoundary(benchmark::State& state)
+{
+  const benchmarks::Goursat goursat( state.range(0) );
+  const Z3i::KSpace & K = goursat.space();
+  const Z3i::SCell bel = Surfaces<Z3i::KSpace>::findABel( K, goursat.digitizer(), 100000 );
+  std::size_t nbSurfels = 0;
+  while (state.KeepRunning())
+    {
+      Z3i::KSpace::SCellSet surface;
+      Surfaces<Z3i::KSpace>::trackBoundary( surface, K, SurfelAdjacency<3>( true ),
+                                            goursat.digitizer(), bel );
+      nbSurfels = surface.size();
+    }
+  state.SetItemsProcessed(state.iterations() * nbSurfels);
+}
+BENCHMARK(BM_TrackBoundary)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_LightImplicitDigitalSurface(benchmark::State& state)
+{
+  typedef LightImplicitDigitalSurface<Z3i::KSpace, benchmarks::Goursat::Digitizer> Boundary;
+  typedef DigitalSurface<Boundary> Surface;
+  const benchmarks::Goursat goursat( state.range(0) );
+  const Z3i::KSpace & K = goursat.space();
+  const Z3i::SCell bel = Surfaces<Z3i::KSpace>::findABel( K, goursat.digitizer(), 100000 );
+  const Surface surface( new Boundary( K, goursat.digitizer(), SurfelAdjacency<3>( true ), bel ) );
+  std::size_t nbSurfels = 0;
+  while (state.KeepRunning())
+    {
+      BreadthFirstVisitor<Surface> visitor( surface, bel );
+      nbSurfels = 0;
+      while ( ! visitor.finished() )
+        {
+          ++nbSurfels;
+          visitor.expand();
+        }
+    }
+  state.SetItemsProcessed(state.iterations() * nbSurfels);
+}
+BENCHMARK(BM_LightImplicitDigitalSurface)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+static void BM_DigitalSetBoundary(benchmark::State& state)
+{
+  typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Boundary;
+  const Z3i::DigitalSet set = benchmarks::ball( state.range(0) );
+  Z3i::KSpace K;
+  K.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+  std::size_t nbSurfels = 0;
+  while (state.KeepRunning())
+    {
+      const Boundary boundary( K, set );
+      nbSurfels = boundary.nbSurfels();
+    }
+  state.SetItemsProcessed(state.iterations() * nbSurfels);
+}
+BENCHMARK(BM_DigitalSetBoundary)->RangeMultiplier(2)->Range(32, 128)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkThinning.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks of the thinning of cubical complexes by parallel directional collapses.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <map>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/ParDirCollapse.h"
+#include "BenchmarkInputs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+template <typename KSpace, typename DigitalSet>
+static void thinning(benchmark::State& state, const DigitalSet & set)
+{
+  typedef std::map<typename KSpace::Cell, CubicalCellData> Map;
+  typedef CubicalComplex<KSpace, Map> Complex;
+  KSpace K;
+  K.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+  std::size_t nbCells = 0;
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Complex complex( K );
+      complex.construct( set );
+      nbCells = complex.size();
+      state.ResumeTiming();
+      ParDirCollapse<Complex> collapse( K );
+      collapse.attach( &complex );
+      benchmark::DoNotOptimize( collapse.eval( 4 ) );
+    }
+  state.SetItemsProcessed(state.iterations() * nbCells);
+}
+
+static void BM_ParDirCollapse2D(benchmark::State& state)
+{
+  thinning<Z2i::KSpace>( state, benchmarks::flower( state.range(0) ) );
+}
+BENCHMARK(BM_ParDirCollapse2D)->RangeMultiplier(2)->Range(16, 32)->Unit(benchmark::kMillisecond);
+
+static void BM_ParDirCollapse3D(benchmark::State& state)
+{
+  thinning<Z3i::KSpace>( state, benchmarks::ball( state.range(0) ) );
+}
+BENCHMARK(BM_ParDirCollapse3D)->RangeMultiplier(2)->Range(8, 16)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
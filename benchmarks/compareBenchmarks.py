@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+#
+# Compares the results of the DGtal benchmarks (google-benchmark JSON
+# files, as written by the 'benchmark' target) with stored baselines.
+#
+#   compareBenchmarks.py [--threshold T] BASELINE CURRENT
+#
+#     BASELINE and CURRENT are JSON files, or directories whose JSON
+#     files are matched by name. Prints the ratio current/baseline of
+#     the real time of each benchmark present in both, and exits with
+#     status 1 if one of them is above 1+T (default T=0.10), or if a
+#     baseline file or benchmark is missing from CURRENT.
+#
+#   compareBenchmarks.py --store BASELINE CURRENT
+#
+#     Copies the JSON files of CURRENT into the directory BASELINE.
+#
+
+import argparse
+import glob
+import json
+import os
+import shutil
+import sys
+
+TIME_UNITS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def json_files(path):
+    """Returns the JSON files of path (a file or a directory), by name."""
+    if os.path.isdir(path):
+        files = glob.glob(os.path.join(path, '*.json'))
+    else:
+        files = [path]
+    return dict((os.path.basename(f), f) for f in files)
+
+
+def load(filename):
+    """Returns the real time in ns of each benchmark of a JSON file.
+
+    The median of repeated runs is used when it is available,
+    otherwise the fastest run.
+    """
+    with open(filename) as f:
+        data = json.load(f)
+    times = {}
+    medians = {}
+    for b in data.get('benchmarks', []):
+        if b.get('error_occurred'):
+            continue
+        t = b['real_time'] * TIME_UNITS[b.get('time_unit', 'ns')]
+        if b.get('run_type') == 'aggregate':
+            if b.get('aggregate_name') == 'median':
+                medians[b['run_name']] = t
+            continue
+        name = b.get('run_name', b['name'])
+        times[name] = min(t, times.get(name, t))
+    times.update(medians)
+    return times
+
+
+def compare(baseline, current, threshold):
+    """Prints the comparison and returns the number of regressions and
+    the number of baseline files or benchmarks missing from current."""
+    nb_regressions = 0
+    nb_missing = 0
+    baseline_files = json_files(baseline)
+    current_files = json_files(current)
+    if len(baseline_files) == 1 and len(current_files) == 1:
+        pairs = [(list(baseline_files.values())[0], list(current_files.values())[0])]
+    else:
+        pairs = [(baseline_files[n], current_files[n])
+                 for n in sorted(current_files) if n in baseline_files]
+        for n in sorted(baseline_files):
+            if n not in current_files:
+                print('%s  MISSING' % n)
+                nb_missing += 1
+    for base_file, cur_file in pairs:
+        base = load(base_file)
+        cur = load(cur_file)
+        print('%s' % os.path.basename(cur_file))
+        for name in sorted(base):
+            if name not in cur:
+                print('  %-60s %12s     MISSING' % (name, ''))
+                nb_missing += 1
+        for name in sorted(cur):
+            if name not in base or base[name] <= 0.0:
+                print('  %-60s %12.0f ns  (new)' % (name, cur[name]))
+                continue
+            ratio = cur[name] / base[name]
+            status = ''
+            if ratio > 1.0 + threshold:
+                status = 'REGRESSION'
+                nb_regressions += 1
+            elif ratio < 1.0 - threshold:
+                status = 'improvement'
+            print('  %-60s %12.0f ns  x%5.2f  %s' % (name, cur[name], ratio, status))
+    return nb_regressions, nb_missing
+
+
+def store(baseline, current):
+    """Copies the JSON files of current into the directory baseline."""
+    if not os.path.isdir(baseline):
+        os.makedirs(baseline)
+    for name, f in sorted(json_files(current).items()):
+        shutil.copy(f, os.path.join(baseline, name))
+        print('stored %s' % name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares DGtal benchmark results with baselines.')
+    parser.add_argument('baseline', help='baseline JSON file or directory')
+    parser.add_argument('current', help='current JSON file or directory')
+    parser.add_argument('--threshold', type=float, default=0.10,
+                        help='relative slowdown reported as a regression (default 0.10)')
+    parser.add_argument('--store', action='store_true',
+                        help='store the current results as baselines instead of comparing')
+    args = parser.parse_args()
+    if args.store:
+        store(args.baseline, args.current)
+        return 0
+    nb_regressions, nb_missing = compare(args.baseline, args.current, args.threshold)
+    if nb_regressions > 0:
+        print('%d regression(s) above %d%%' % (nb_regressions, int(args.threshold * 100)))
+    if nb_missing > 0:
+        print('%d missing result file(s) or benchmark(s)' % nb_missing)
+    return 1 if nb_regressions + nb_missing > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
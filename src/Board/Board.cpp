@@ -102,14 +102,20 @@ Board::State::State()
 }
 
 Board::Board( const DGtal::Color & bgColor )
-  : _backgroundColor( bgColor )
+  : _backgroundColor( bgColor ),
+    _stream( 0 ),
+    _streamFormat( StreamSVG ),
+    _streamRun( 0 )
 {
 }
 
 Board::Board( const Board & other )
   : ShapeList( other ),
     _state( other._state ),
-    _backgroundColor( other._backgroundColor )
+    _backgroundColor( other._backgroundColor ),
+    _stream( 0 ),
+    _streamFormat( StreamSVG ),
+    _streamRun( 0 )
 {
 }
 
@@ -132,7 +138,14 @@ Board::operator=( const Board & other )
 Board &
 Board::operator<<( const Shape & shape )
 {
+  const std::size_t first = _shapes.size();
   ShapeList::addShape( shape, _state.unitFactor );
+  if ( _stream ) {
+    std::vector<Shape*> added( _shapes.begin() + first, _shapes.end() );
+    _shapes.resize( first );
+    for ( std::size_t i = 0; i < added.size(); ++i )
+      pushShape( added[i] );
+  }
   return *this;
 }
 
@@ -145,7 +158,8 @@ Board::operator<<( Unit unit )
 
 Board::~Board()
 {
-
+  endStream();
+  delete _streamRun;
 }
 
 void
@@ -357,10 +371,10 @@ void
 Board::drawDot( double x, double y, int depthValue )
 {  
   if ( depthValue != -1 ) 
-    _shapes.push_back( new Dot( _state.unit(x), _state.unit(y),
+    pushShape( new Dot( _state.unit(x), _state.unit(y),
         _state.penColor, _state.lineWidth, depthValue ) );
   else
-    _shapes.push_back( new Dot( _state.unit(x), _state.unit(y),
+    pushShape( new Dot( _state.unit(x), _state.unit(y),
         _state.penColor, _state.lineWidth, _nextDepth-- ) );
 }
 
@@ -369,12 +383,12 @@ Board::drawLine( double x1, double y1, double x2, double y2,
      int depthValue /* = -1 */  )
 {
   if ( depthValue != -1 ) 
-    _shapes.push_back( new Line( _state.unit(x1), _state.unit(y1),
+    pushShape( new Line( _state.unit(x1), _state.unit(y1),
          _state.unit(x2), _state.unit(y2),
          _state.penColor, _state.lineWidth,
          _state.lineStyle, _state.lineCap, _state.lineJoin, depthValue ) );
   else
-    _shapes.push_back( new Line( _state.unit(x1), _state.unit(y1),
+    pushShape( new Line( _state.unit(x1), _state.unit(y1),
          _state.unit(x2), _state.unit(y2),
          _state.penColor, _state.lineWidth,
          _state.lineStyle, _state.lineCap, _state.lineJoin, _nextDepth-- ) );
@@ -385,12 +399,12 @@ Board::drawQuadraticBezierCurve( double x1, double y1, double x2, double y2, dou
      int depthValue /* = -1 */  )
 {
   if ( depthValue != -1 ) 
-    _shapes.push_back( new QuadraticBezierCurve( _state.unit(x1), _state.unit(y1),
+    pushShape( new QuadraticBezierCurve( _state.unit(x1), _state.unit(y1),
          _state.unit(x2), _state.unit(y2), _state.unit(x3), _state.unit(y3),
          _state.penColor, _state.fillColor, _state.lineWidth,
          _state.lineStyle, _state.lineCap, _state.lineJoin, depthValue ) );
   else
-    _shapes.push_back( new QuadraticBezierCurve( _state.unit(x1), _state.unit(y1),
+    pushShape( new QuadraticBezierCurve( _state.unit(x1), _state.unit(y1),
          _state.unit(x2), _state.unit(y2), _state.unit(x3), _state.unit(y3),
          _state.penColor, _state.fillColor, _state.lineWidth,
          _state.lineStyle, _state.lineCap, _state.lineJoin, _nextDepth-- ) );
@@ -402,12 +416,12 @@ Board::drawArrow( double x1, double y1, double x2, double y2,
       int depthValue /* = -1 */  )
 {
   if ( depthValue != -1 )
-    _shapes.push_back( new Arrow( _state.unit(x1), _state.unit(y1),
+    pushShape( new Arrow( _state.unit(x1), _state.unit(y1),
           _state.unit(x2), _state.unit(y2),
           _state.penColor, filledArrow ? _state.penColor : DGtal::Color::None,
           _state.lineWidth, _state.lineStyle, _state.lineCap, _state.lineJoin, depthValue ) );
   else
-    _shapes.push_back( new Arrow( _state.unit(x1), _state.unit(y1),
+    pushShape( new Arrow( _state.unit(x1), _state.unit(y1),
           _state.unit(x2), _state.unit(y2),
           _state.penColor, filledArrow ? _state.penColor : DGtal::Color::None,
           _state.lineWidth, _state.lineStyle, _state.lineCap, _state.lineJoin, _nextDepth-- ) );
@@ -419,7 +433,7 @@ Board::drawRectangle( double x, double y,
           int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Rectangle( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height), 
+  pushShape( new Rectangle( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height), 
             _state.penColor, _state.fillColor,
             _state.lineWidth, _state.lineStyle, _state.lineCap, _state.lineJoin, d ) );
 }
@@ -430,18 +444,30 @@ Board::drawImage(std::string filename, double x, double y,
      int depthValue, double alpha /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Image( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height), 
+  pushShape( new Image( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height), 
         filename, d, alpha ) );
 }
 
 
+void
+Board::drawRaster( double x, double y,
+                   double width, double height,
+                   unsigned int columns, unsigned int rows,
+                   const std::vector<DGtal::Color> & pixels,
+                   int depthValue /* = -1 */ )
+{
+  int d = (depthValue != -1) ? depthValue : _nextDepth--;
+  pushShape( new Raster( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height),
+                         columns, rows, pixels, d ) );
+}
+
 void
 Board::fillRectangle( double x, double y,
           double width, double height,
           int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Rectangle( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height),
+  pushShape( new Rectangle( _state.unit(x), _state.unit(y), _state.unit(width), _state.unit(height),
             DGtal::Color::None, _state.penColor,
             0.0f, _state.lineStyle, _state.lineCap, _state.lineJoin,
             d ) );
@@ -452,7 +478,7 @@ Board::drawCircle( double x, double y, double radius,
        int depthValue /* = -1 */  )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Circle( _state.unit(x), _state.unit(y), _state.unit(radius), 
+  pushShape( new Circle( _state.unit(x), _state.unit(y), _state.unit(radius), 
          _state.penColor, _state.fillColor,
          _state.lineWidth, _state.lineStyle, d ) );
 }
@@ -461,7 +487,7 @@ void
 Board::drawArc(double x, double y, double radius, double angle1, double angle2, 
 	       bool neg, int depthValue /*= -1*/ ){
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Arc( _state.unit(x), _state.unit(y), _state.unit(radius), 
+  pushShape( new Arc( _state.unit(x), _state.unit(y), _state.unit(radius), 
 			      angle1, angle2, neg,_state.penColor,
 			      DGtal::Color::None, _state.lineWidth, _state.lineStyle, d ) );
 }
@@ -473,7 +499,7 @@ Board::fillCircle( double x, double y,
        int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Circle( _state.unit(x), _state.unit(y), _state.unit(radius), 
+  pushShape( new Circle( _state.unit(x), _state.unit(y), _state.unit(radius), 
          DGtal::Color::None, _state.penColor,
          0.0f, _state.lineStyle, d ) );
 }
@@ -484,7 +510,7 @@ Board::drawEllipse( double x, double y,
         int depthValue /* = -1 */  )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Ellipse( _state.unit(x), _state.unit(y),
+  pushShape( new Ellipse( _state.unit(x), _state.unit(y),
           _state.unit(xRadius), _state.unit(yRadius),
           _state.penColor,
           _state.fillColor,
@@ -499,7 +525,7 @@ Board::fillEllipse( double x, double y,
         int depthValue /* = -1 */ )
 {
   int d = depthValue ? depthValue : _nextDepth--;
-  _shapes.push_back( new Ellipse( _state.unit(x), _state.unit(y), _state.unit(xRadius), _state.unit(yRadius),
+  pushShape( new Ellipse( _state.unit(x), _state.unit(y), _state.unit(xRadius), _state.unit(yRadius),
           DGtal::Color::None,
           _state.penColor,
           0.0f, 
@@ -519,7 +545,7 @@ Board::drawPolyline( const std::vector<Point> & points,
     (*it) = _state.unit( *it );
     ++it;
   }
-  _shapes.push_back( new Polyline( v, false, _state.penColor, _state.fillColor,
+  pushShape( new Polyline( v, false, _state.penColor, _state.fillColor,
            _state.lineWidth,
            _state.lineStyle,
            _state.lineCap,
@@ -539,7 +565,7 @@ Board::drawClosedPolyline( const std::vector<Point> & points,
     (*it) = _state.unit( *it );
     ++it;
   }
-  _shapes.push_back( new Polyline( v, true, _state.penColor, _state.fillColor,
+  pushShape( new Polyline( v, true, _state.penColor, _state.fillColor,
            _state.lineWidth,
            _state.lineStyle,
            _state.lineCap,
@@ -559,7 +585,7 @@ Board::fillPolyline( const std::vector<Point> & points,
     (*it) = _state.unit( *it );
     ++it;
   }
-  _shapes.push_back( new Polyline( v, true, DGtal::Color::None, _state.penColor,
+  pushShape( new Polyline( v, true, DGtal::Color::None, _state.penColor,
            0.0f,
            _state.lineStyle,
            _state.lineCap,
@@ -578,7 +604,7 @@ Board::drawTriangle( double x1, double y1,
   points.push_back( Point( _state.unit(x1), _state.unit(y1) ) );
   points.push_back( Point( _state.unit(x2), _state.unit(y2) ) );
   points.push_back( Point( _state.unit(x3), _state.unit(y3) ) );
-  _shapes.push_back( new Polyline( points, true, _state.penColor, _state.fillColor,
+  pushShape( new Polyline( points, true, _state.penColor, _state.fillColor,
            _state.lineWidth,
            _state.lineStyle,
            _state.lineCap,
@@ -597,7 +623,7 @@ Board::drawTriangle( const Point & p1,
   points.push_back( Point( _state.unit(p1.x), _state.unit(p1.y) ) );
   points.push_back( Point( _state.unit(p2.x), _state.unit(p2.y) ) );
   points.push_back( Point( _state.unit(p3.x), _state.unit(p3.y) ) );
-  _shapes.push_back( new Polyline( points, true, _state.penColor, _state.fillColor,
+  pushShape( new Polyline( points, true, _state.penColor, _state.fillColor,
            _state.lineWidth,
            _state.lineStyle,
            _state.lineCap,
@@ -616,7 +642,7 @@ Board::fillTriangle( double x1, double y1,
   points.push_back( Point( _state.unit(x1), _state.unit(y1) ) );
   points.push_back( Point( _state.unit(x2), _state.unit(y2) ) );
   points.push_back( Point( _state.unit(x3), _state.unit(y3) ) );
-  _shapes.push_back( new Polyline( points, true, DGtal::Color::None, _state.penColor,
+  pushShape( new Polyline( points, true, DGtal::Color::None, _state.penColor,
            0.0f,
            _state.lineStyle,
            _state.lineCap,
@@ -635,7 +661,7 @@ Board::fillTriangle( const Point & p1,
   points.push_back( Point( _state.unit(p1.x), _state.unit(p1.y) ) );
   points.push_back( Point( _state.unit(p2.x), _state.unit(p2.y) ) );
   points.push_back( Point( _state.unit(p3.x), _state.unit(p3.y) ) );
-  _shapes.push_back( new Polyline( points, true, DGtal::Color::None, _state.penColor,
+  pushShape( new Polyline( points, true, DGtal::Color::None, _state.penColor,
            0.0f,
            _state.lineStyle,
            _state.lineCap,
@@ -654,7 +680,7 @@ Board::fillGouraudTriangle( const Point & p1,
           int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new GouraudTriangle( Point( _state.unit(p1.x), _state.unit(p1.y) ), color1,
+  pushShape( new GouraudTriangle( Point( _state.unit(p1.x), _state.unit(p1.y) ), color1,
             Point( _state.unit(p2.x), _state.unit(p2.y) ), color2,
             Point( _state.unit(p3.x), _state.unit(p3.y) ), color3,
             divisions, d ) );
@@ -694,7 +720,7 @@ Board::drawText( double x, double y, const char * text,
      int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Text( _state.unit(x), _state.unit(y), text,
+  pushShape( new Text( _state.unit(x), _state.unit(y), text,
              _state.font, _state.fontSize, _state.penColor, d ) );
 }
 
@@ -702,7 +728,7 @@ void
 Board::drawText( double x, double y, const std::string & str, int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
-  _shapes.push_back( new Text( _state.unit(x), _state.unit(y), str,
+  pushShape( new Text( _state.unit(x), _state.unit(y), str,
              _state.font, _state.fontSize, _state.penColor, d ) );
 }
 
@@ -711,7 +737,7 @@ Board::drawBoundingBox( int depthValue /* = -1 */ )
 {
   int d = (depthValue != -1) ? depthValue : _nextDepth--;
   Rect box = boundingBox();
-  _shapes.push_back( new Rectangle( _state.unit(box.left),
+  pushShape( new Rectangle( _state.unit(box.left),
             _state.unit(box.top),
             _state.unit(box.width),
             _state.unit(box.height),
@@ -826,7 +852,26 @@ Board::saveEPS( std::ostream &out, double pageWidth, double pageHeight, double m
   
   TransformEPS transform;
   transform.setBoundingBox( box, pageWidth, pageHeight, margin );
-  
+  writeEPSHeader( out, transform, box );
+
+  // Draw the shapes
+  std::vector< Shape* > shapes = _shapes;
+
+  stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
+  std::vector< Shape* >::const_iterator i = shapes.begin();
+  std::vector< Shape* >::const_iterator end = shapes.end();
+
+  while ( i != end ) {
+    (*i)->flushPostscript( out, transform );
+    ++i;
+  }
+  writeEPSFooter( out );
+}
+
+void
+Board::writeEPSHeader( std::ostream &out, const TransformEPS & transform, const Rect & box ) const
+{
+  bool clipping = _clippingPath.size() > 2;
   out << "%!PS-Adobe-2.0 EPSF-2.0" << std::endl;
   out << "%%Title:  output.eps " << std::endl;
   out << "%%Creator: Board library (Copyleft)2007 Sebastien Fourey" << std::endl;
@@ -884,18 +929,11 @@ Board::saveEPS( std::ostream &out, double pageWidth, double pageHeight, double m
     Rectangle r( box, DGtal::Color::None, _backgroundColor, 0.0f );
     r.flushPostscript( out, transform );
   }
+}
 
-  // Draw the shapes
-  std::vector< Shape* > shapes = _shapes;
-
-  stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
-  std::vector< Shape* >::const_iterator i = shapes.begin();
-  std::vector< Shape* >::const_iterator end = shapes.end();
-
-  while ( i != end ) {
-    (*i)->flushPostscript( out, transform );
-    ++i;
-  }
+void
+Board::writeEPSFooter( std::ostream &out ) const
+{
   out << "showpage" << std::endl;
   out << "%%Trailer" << std::endl;
   out << "%EOF" << std::endl;
@@ -969,6 +1007,12 @@ Board::saveFIG( std::ostream &file, double pageWidth, double pageHeight, double
     if ( colormap.find( (*i)->fillColor() ) == colormap.end()
    && (*i)->fillColor().valid() )
       colormap[ (*i)->fillColor() ] = maxColor++;
+    const Raster * raster = dynamic_cast<const Raster*>( *i );
+    if ( raster )
+      for ( unsigned int y = 0; y < raster->rows(); ++y )
+        for ( unsigned int x = 0; x < raster->columns(); ++x )
+          if ( colormap.find( raster->pixel( x, y ) ) == colormap.end() )
+            colormap[ raster->pixel( x, y ) ] = maxColor++;
     ++i;
   }
 
@@ -1041,7 +1085,25 @@ Board::saveSVG( std::ostream &file, double pageWidth, double pageHeight, double
   if ( clipping )
     box = box && _clippingPath.boundingBox();
   transform.setBoundingBox( box, pageWidth, pageHeight, margin );
+  writeSVGHeader( file, transform, box, pageWidth, pageHeight, filename );
 
+  // Draw the shapes.
+  std::vector< Shape* > shapes = _shapes;
+  stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
+  std::vector< Shape* >::const_iterator i = shapes.begin();
+  std::vector< Shape* >::const_iterator end = shapes.end();
+  while ( i != end ) {
+    (*i)->flushSVG( file, transform );
+    ++i;
+  }  
+  writeSVGFooter( file );
+}
+
+void
+Board::writeSVGHeader( std::ostream &file, const TransformSVG & transform, const Rect & box,
+                       double pageWidth, double pageHeight, const std::string & filename ) const
+{
+  bool clipping = _clippingPath.size() > 2;
   file << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>" << std::endl;
   file << "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"" << std::endl;
   file << " \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">" << std::endl;
@@ -1053,7 +1115,7 @@ Board::saveSVG( std::ostream &file, double pageWidth, double pageHeight, double
     file << "     viewBox=\"0 0 "
     << pageWidth * ppmm  << " "
     << pageHeight * ppmm  << "\" " << std::endl;
-    file << "     xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" >" << std::endl;
+    file << "     xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" >" << std::endl;
   } else {
     file << "<svg width=\""
    << ( box.width / ppmm )  << "mm"
@@ -1086,21 +1148,90 @@ Board::saveSVG( std::ostream &file, double pageWidth, double pageHeight, double
     Rectangle r( box, DGtal::Color::None, _backgroundColor, 0.0 );
     r.flushSVG( file, transform );
   }
-  
-  // Draw the shapes.
-  std::vector< Shape* > shapes = _shapes;
-  stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
-  std::vector< Shape* >::const_iterator i = shapes.begin();
-  std::vector< Shape* >::const_iterator end = shapes.end();
-  while ( i != end ) {
-    (*i)->flushSVG( file, transform );
-    ++i;
-  }  
+}
 
-  if ( clipping )
+void
+Board::writeSVGFooter( std::ostream &file ) const
+{
+  if ( _clippingPath.size() > 2 )
     file << "</g>\n</g>";
   file << "</svg>" << std::endl;
- 
+}
+
+void
+Board::beginStream( std::ostream & out, StreamFormat format, const Rect & box,
+                    double pageWidth, double pageHeight, double margin )
+{
+  if ( _stream )
+    endStream();
+  Rect streamBox( _state.unit( box.left ), _state.unit( box.top ),
+                  _state.unit( box.width ), _state.unit( box.height ) );
+  if ( _clippingPath.size() > 2 )
+    streamBox = streamBox && _clippingPath.boundingBox();
+  _stream = &out;
+  _streamFormat = format;
+  if ( format == StreamSVG ) {
+    _streamTransformSVG.setBoundingBox( streamBox, pageWidth, pageHeight, margin );
+    writeSVGHeader( out, _streamTransformSVG, streamBox, pageWidth, pageHeight, "output.svg" );
+  } else {
+    _streamTransformEPS.setBoundingBox( streamBox, pageWidth, pageHeight, margin );
+    writeEPSHeader( out, _streamTransformEPS, streamBox );
+  }
+}
+
+void
+Board::endStream()
+{
+  if ( ! _stream ) return;
+  flushStreamRun();
+  if ( _streamFormat == StreamSVG )
+    writeSVGFooter( *_stream );
+  else
+    writeEPSFooter( *_stream );
+  _stream = 0;
+}
+
+bool
+Board::isStreaming() const
+{
+  return _stream != 0;
+}
+
+void
+Board::pushShape( Shape * shape )
+{
+  if ( ! _stream ) {
+    _shapes.push_back( shape );
+    return;
+  }
+  if ( typeid( *shape ) == typeid( Rectangle ) ) {
+    Rectangle * rectangle = static_cast<Rectangle*>( shape );
+    if ( _streamRun && _streamRun->extend( *rectangle ) ) {
+      delete rectangle;
+      return;
+    }
+    flushStreamRun();
+    _streamRun = rectangle;
+    return;
+  }
+  flushStreamRun();
+  if ( _streamFormat == StreamSVG )
+    shape->flushSVG( *_stream, _streamTransformSVG );
+  else
+    shape->flushPostscript( *_stream, _streamTransformEPS );
+  delete shape;
+}
+
+void
+Board::flushStreamRun()
+{
+  if ( ! _streamRun ) return;
+  if ( _streamFormat == StreamSVG )
+    _streamRun->flushSVG( *_stream, _streamTransformSVG );
+  else
+    _streamRun->flushPostscript( *_stream, _streamTransformEPS );
+  delete _streamRun;
+  _streamRun = 0;
 }
 
 
@@ -40,6 +40,7 @@ public:
   enum CairoType { CairoPDF, CairoPNG, CairoPS, CairoEPS, CairoSVG };
 
   enum PageSize { BoundingBox, A4, Letter };
+  enum StreamFormat { StreamSVG, StreamEPS };
   enum Unit { UPoint, UInche, UCentimeter, UMillimeter };
   static const double Degree;
   
@@ -380,6 +381,26 @@ public:
           double width, double height,
       int depthValue = -1, double alpha=1.0 );
 
+  /** 
+   * Draws an array of colored pixels, embedded in the output file as
+   * a single image (see Raster).
+   * 
+   * @param x First coordinate of the upper left corner.
+   * @param y Second coordinate of the upper left corner.
+   * @param width Width of the raster.
+   * @param height Height of the raster.
+   * @param columns Number of columns of pixels.
+   * @param rows Number of rows of pixels.
+   * @param pixels Colors of the pixels, row by row from the top row,
+   * each row from left to right.
+   * @param depthValue Depth of the raster.
+   */
+  void drawRaster( double x, double y, 
+                   double width, double height,
+                   unsigned int columns, unsigned int rows,
+                   const std::vector<DGtal::Color> & pixels,
+                   int depthValue = -1 );
+
   /** 
    * Draws a rectangle filled with the current pen color.
    * 
@@ -689,6 +710,44 @@ public:
           double scaleY,
           double angle = 0.0 );
 
+  /** 
+   * Starts the streaming mode: the header of the file is written to
+   * the stream, then the shapes given to the drawSomething() methods
+   * and to operator<< are written as soon as they are drawn, instead
+   * of being stored in the board. Consecutive axis-aligned rectangles
+   * of the same style that are horizontally adjacent (e.g. the pixels
+   * of a row of an image) are merged into a single rectangle.
+   *
+   * Since nothing is stored, the bounding box of the drawing must be
+   * given in advance, and shapes are written in drawing order, their
+   * depth being ignored.
+   * 
+   * The streaming mode is ended by endStream(), or by the destructor
+   * of the board.
+   *
+   * @param out The output stream, which must outlive the streaming mode.
+   * @param format The output format (StreamSVG or StreamEPS).
+   * @param box The bounding box of the drawing, in the current unit.
+   * @param pageWidth Width of the page in millimeters, or 0 for the
+   * bounding box.
+   * @param pageHeight Height of the page in millimeters, or 0 for the
+   * bounding box.
+   * @param margin Minimal margin around the figure in the page, in millimeters.
+   */
+  void beginStream( std::ostream & out, StreamFormat format, const Rect & box,
+                    double pageWidth = 0.0, double pageHeight = 0.0, double margin = 10.0 );
+
+  /** 
+   * Ends the streaming mode: the pending shapes and the trailer of
+   * the file are written to the stream.
+   */
+  void endStream();
+
+  /** 
+   * @return true if the board is in streaming mode.
+   */
+  bool isStreaming() const;
+
   /** 
    * Save the drawing in an EPS, XFIG or SVG file depending 
    * on the filename extension. When a size is given (not BoundingBox), the drawing is
@@ -955,6 +1014,32 @@ public:
   State _state;       /**< The current state. */
   DGtal::Color _backgroundColor;   /**< The color of the background. */
   Path _clippingPath;
+
+  std::ostream * _stream;      /**< The output stream of the streaming mode, or 0. */
+  StreamFormat _streamFormat;  /**< The format of the streaming mode. */
+  TransformSVG _streamTransformSVG; /**< The transform of the SVG streaming mode. */
+  TransformEPS _streamTransformEPS; /**< The transform of the EPS streaming mode. */
+  Rectangle * _streamRun;      /**< The pending run of rectangles of the streaming mode, or 0. */
+
+private:
+
+  /** 
+   * Adds a shape to the board, or writes it in streaming mode.
+   * 
+   * @param shape A shape, owned by the board.
+   */
+  void pushShape( Shape * shape );
+
+  /** 
+   * Writes the pending run of rectangles of the streaming mode, if any.
+   */
+  void flushStreamRun();
+
+  void writeEPSHeader( std::ostream & out, const TransformEPS & transform, const Rect & box ) const;
+  void writeEPSFooter( std::ostream & out ) const;
+  void writeSVGHeader( std::ostream & out, const TransformSVG & transform, const Rect & box,
+                       double pageWidth, double pageHeight, const std::string & filename ) const;
+  void writeSVGFooter( std::ostream & out ) const;
 };
 
 } // namespace LibBoard
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <vector>
 #include <sstream>
+#include <algorithm>
 
 #include <assert.h>
 
@@ -724,6 +725,317 @@ Image::flushTikZ( std::ostream & stream,
          << "]{" << _filename << "}};" << std::endl;
 }
 
+/*
+ * Raster
+ */
+
+namespace {
+
+  /*
+   * Writes bytes in base 64, without line breaks.
+   */
+  class Base64Writer {
+  public:
+    Base64Writer( std::ostream & stream ) : _stream( stream ), _size( 0 ) { }
+    ~Base64Writer() { finish(); }
+    void put( unsigned char byte ) {
+      _bytes[ _size++ ] = byte;
+      if ( _size == 3 ) encode();
+    }
+    void finish() {
+      if ( _size ) encode();
+      _stream.write( _line.data(), _line.size() );
+      _line.clear();
+    }
+  private:
+    void encode() {
+      static const char digits[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+      const unsigned char b1 = _size > 1 ? _bytes[1] : 0;
+      const unsigned char b2 = _size > 2 ? _bytes[2] : 0;
+      _line += digits[ _bytes[0] >> 2 ];
+      _line += digits[ ( ( _bytes[0] & 3 ) << 4 ) | ( b1 >> 4 ) ];
+      _line += _size > 1 ? digits[ ( ( b1 & 15 ) << 2 ) | ( b2 >> 6 ) ] : '=';
+      _line += _size > 2 ? digits[ b2 & 63 ] : '=';
+      _size = 0;
+      if ( _line.size() >= 4096 ) {
+        _stream.write( _line.data(), _line.size() );
+        _line.clear();
+      }
+    }
+    std::ostream & _stream;
+    unsigned char _bytes[3];
+    unsigned int _size;
+    std::string _line;
+  };
+
+  /*
+   * Writes the chunks of a PNG file.
+   */
+  class PNGChunkWriter {
+  public:
+    PNGChunkWriter( Base64Writer & out ) : _out( out ), _crc( 0 ) { }
+    void begin( const char * type, DGtal::uint32_t length ) {
+      for ( int shift = 24; shift >= 0; shift -= 8 )
+        _out.put( static_cast<unsigned char>( length >> shift ) );
+      _crc = 0xFFFFFFFFu;
+      for ( int i = 0; i < 4; ++i )
+        byte( static_cast<unsigned char>( type[i] ) );
+    }
+    void byte( unsigned char b ) {
+      _out.put( b );
+      _crc = table()[ ( _crc ^ b ) & 0xFF ] ^ ( _crc >> 8 );
+    }
+    void word( DGtal::uint32_t w ) {
+      for ( int shift = 24; shift >= 0; shift -= 8 )
+        byte( static_cast<unsigned char>( w >> shift ) );
+    }
+    void end() {
+      const DGtal::uint32_t crc = _crc ^ 0xFFFFFFFFu;
+      for ( int shift = 24; shift >= 0; shift -= 8 )
+        _out.put( static_cast<unsigned char>( crc >> shift ) );
+    }
+  private:
+    static const DGtal::uint32_t * table() {
+      // Initialized once, thread-safely, at the first call.
+      static const std::vector<DGtal::uint32_t> crcs = crcTable();
+      return &crcs[ 0 ];
+    }
+    static std::vector<DGtal::uint32_t> crcTable() {
+      std::vector<DGtal::uint32_t> crcs( 256 );
+      for ( DGtal::uint32_t n = 0; n < 256; ++n ) {
+        DGtal::uint32_t c = n;
+        for ( int k = 0; k < 8; ++k )
+          c = ( c & 1 ) ? 0xEDB88320u ^ ( c >> 1 ) : c >> 1;
+        crcs[ n ] = c;
+      }
+      return crcs;
+    }
+    Base64Writer & _out;
+    DGtal::uint32_t _crc;
+  };
+
+  /*
+   * Writes a zlib stream of stored (uncompressed) deflate blocks, one
+   * block per IDAT chunk, so that no chunk exceeds the PNG limits.
+   */
+  class IDATWriter {
+  public:
+    IDATWriter( PNGChunkWriter & png, std::size_t size )
+      : _png( png ), _remaining( size ), _block( 0 ), _first( true ), _a( 1 ), _b( 0 ) { }
+    void put( unsigned char byte ) {
+      if ( ! _block ) beginBlock();
+      _png.byte( byte );
+      _a = ( _a + byte ) % 65521;
+      _b = ( _b + _a ) % 65521;
+      --_block;
+      if ( ! --_remaining ) {
+        _png.word( ( _b << 16 ) | _a );
+        _png.end();
+      } else if ( ! _block ) _png.end();
+    }
+  private:
+    void beginBlock() {
+      _block = static_cast<unsigned int>( std::min<std::size_t>( _remaining, 65535 ) );
+      const bool last = _block == _remaining;
+      _png.begin( "IDAT", ( _first ? 2 : 0 ) + 5 + _block + ( last ? 4 : 0 ) );
+      if ( _first ) {
+        _png.byte( 0x78 );
+        _png.byte( 0x01 );
+        _first = false;
+      }
+      _png.byte( last ? 1 : 0 );
+      _png.byte( _block & 0xFF );
+      _png.byte( _block >> 8 );
+      _png.byte( ~_block & 0xFF );
+      _png.byte( ( ~_block >> 8 ) & 0xFF );
+    }
+    PNGChunkWriter & _png;
+    std::size_t _remaining;
+    unsigned int _block;
+    bool _first;
+    DGtal::uint32_t _a;
+    DGtal::uint32_t _b;
+  };
+
+}
+
+const std::string Raster::_name("Raster");
+
+Raster::Raster( double x, double y, double aWidth, double aHeight, 
+                unsigned int columns, unsigned int rows,
+                const std::vector<DGtal::Color> & pixels,
+                int depthValue )
+  : Rectangle( x, y, aWidth, aHeight, DGtal::Color::None, DGtal::Color::None, 0.0,
+               SolidStyle, ButtCap, MiterJoin, depthValue ),
+    _columns( columns ), _rows( rows ), _pixels( pixels )
+{
+  assert( _pixels.size() == static_cast<std::size_t>( columns ) * rows );
+}
+
+const std::string &
+Raster::name() const
+{
+    return _name;
+}
+
+Raster *
+Raster::clone() const {
+  return new Raster(*this);
+}
+
+std::vector<Polyline>
+Raster::runs() const
+{
+  std::vector<Polyline> result;
+  if ( ! _columns || ! _rows ) return result;
+  const Point u = ( _path[1] - _path[0] ) / _columns;
+  const Point v = ( _path[3] - _path[0] ) / _rows;
+  for ( unsigned int row = 0; row < _rows; ++row ) {
+    unsigned int column = 0;
+    while ( column < _columns ) {
+      const DGtal::Color & color = pixel( column, row );
+      unsigned int end = column + 1;
+      while ( end < _columns && pixel( end, row ) == color ) ++end;
+      if ( color.alpha() != 0 ) {
+        std::vector<Point> points;
+        points.push_back( _path[0] + u * column + v * row );
+        points.push_back( _path[0] + u * end + v * row );
+        points.push_back( _path[0] + u * end + v * ( row + 1 ) );
+        points.push_back( _path[0] + u * column + v * ( row + 1 ) );
+        result.push_back( Polyline( points, true, DGtal::Color::None, color, 0.0,
+                                    SolidStyle, ButtCap, MiterJoin, _depth ) );
+      }
+      column = end;
+    }
+  }
+  return result;
+}
+
+void
+Raster::flushPostscript( std::ostream & stream,
+                         const TransformEPS & transform ) const
+{
+  if ( ! _columns || ! _rows ) return;
+  // colorimage has no alpha channel.
+  bool opaque = true;
+  for ( std::size_t i = 0; opaque && i < _pixels.size(); ++i )
+    opaque = _pixels[i].alpha() == 255;
+  if ( ! opaque ) {
+    const std::vector<Polyline> polylines = runs();
+    for ( std::size_t i = 0; i < polylines.size(); ++i )
+      polylines[i].flushPostscript( stream, transform );
+    return;
+  }
+  // The unit square is mapped onto the raster from its bottom left
+  // corner, and the rows of the image are read from the top.
+  const double x0 = transform.mapX( _path[3].x );
+  const double y0 = transform.mapY( _path[3].y );
+  stream << "\n% Raster\n"
+         << "gs " << x0 << " " << y0 << " tr ["
+         << transform.mapX( _path[2].x ) - x0 << " " << transform.mapY( _path[2].y ) - y0 << " "
+         << transform.mapX( _path[0].x ) - x0 << " " << transform.mapY( _path[0].y ) - y0
+         << " 0 0] concat\n"
+         << "/rasterline " << 3 * _columns << " string def\n"
+         << _columns << " " << _rows << " 8 [" << _columns << " 0 0 -" << _rows << " 0 " << _rows << "]\n"
+         << "{currentfile rasterline readhexstring pop} false 3 colorimage\n";
+  static const char digits[] = "0123456789abcdef";
+  std::string line;
+  for ( std::size_t i = 0; i < _pixels.size(); ++i ) {
+    const unsigned char rgb[3] = { _pixels[i].red(), _pixels[i].green(), _pixels[i].blue() };
+    for ( int k = 0; k < 3; ++k ) {
+      line += digits[ rgb[k] >> 4 ];
+      line += digits[ rgb[k] & 15 ];
+    }
+    if ( line.size() >= 72 || i + 1 == _pixels.size() ) {
+      stream << line << "\n";
+      line.clear();
+    }
+  }
+  stream << "gr" << std::endl;
+}
+
+void
+Raster::flushFIG( std::ostream & stream,
+                  const TransformFIG & transform,
+                  std::map<DGtal::Color,int> & colormap ) const
+{
+  const std::vector<Polyline> polylines = runs();
+  for ( std::size_t i = 0; i < polylines.size(); ++i )
+    polylines[i].flushFIG( stream, transform, colormap );
+}
+
+void
+Raster::flushSVG( std::ostream & stream,
+                  const TransformSVG & transform ) const
+{
+  if ( ! _columns || ! _rows ) return;
+  if ( _path[0].y != _path[1].y || _path[0].x != _path[3].x
+       || _path[1].x <= _path[0].x || _path[0].y <= _path[3].y ) {
+    const std::vector<Polyline> polylines = runs();
+    for ( std::size_t i = 0; i < polylines.size(); ++i )
+      polylines[i].flushSVG( stream, transform );
+    return;
+  }
+  stream << "<image x=\"" << transform.mapX( _path[0].x ) << '"'
+         << " y=\"" << transform.mapY( _path[0].y )  << '"'
+         << " width=\"" << transform.scale( _path[1].x - _path[0].x ) << '"'
+         << " height=\"" << transform.scale( _path[0].y - _path[3].y ) << '"'
+         << " preserveAspectRatio=\"none\" image-rendering=\"optimizeSpeed\""
+         << " xlink:href=\"data:image/png;base64,";
+  {
+    // 8 bits RGBA PNG, without filtering nor compression.
+    Base64Writer base64( stream );
+    PNGChunkWriter png( base64 );
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    for ( int i = 0; i < 8; ++i )
+      base64.put( signature[i] );
+    png.begin( "IHDR", 13 );
+    png.word( _columns );
+    png.word( _rows );
+    png.byte( 8 );
+    png.byte( 6 );
+    png.byte( 0 );
+    png.byte( 0 );
+    png.byte( 0 );
+    png.end();
+    IDATWriter idat( png, ( 1 + 4 * static_cast<std::size_t>( _columns ) ) * _rows );
+    for ( unsigned int row = 0; row < _rows; ++row ) {
+      idat.put( 0 );
+      for ( unsigned int column = 0; column < _columns; ++column ) {
+        const DGtal::Color & color = pixel( column, row );
+        idat.put( color.red() );
+        idat.put( color.green() );
+        idat.put( color.blue() );
+        idat.put( color.alpha() );
+      }
+    }
+    png.begin( "IEND", 0 );
+    png.end();
+  }
+  stream << "\" />" << std::endl;
+}
+
+#ifdef WITH_CAIRO
+void
+Raster::flushCairo( cairo_t *cr,
+                    const TransformCairo & transform ) const
+{
+  const std::vector<Polyline> polylines = runs();
+  for ( std::size_t i = 0; i < polylines.size(); ++i )
+    polylines[i].flushCairo( cr, transform );
+}
+#endif
+
+void
+Raster::flushTikZ( std::ostream & stream,
+                   const TransformTikZ & transform ) const
+{
+  const std::vector<Polyline> polylines = runs();
+  for ( std::size_t i = 0; i < polylines.size(); ++i )
+    polylines[i].flushTikZ( stream, transform );
+}
+
 /*
  * Arrow
  */
@@ -1923,6 +2235,37 @@ Rectangle::clone() const {
     return new Rectangle(*this);
 }
 
+namespace {
+  bool sameCoordinate( double a, double b )
+  {
+    return fabs( a - b ) <= 1e-9 * std::max( 1.0, std::max( fabs( a ), fabs( b ) ) );
+  }
+}
+
+bool
+Rectangle::extend( const Rectangle & other )
+{
+  if ( _path[0].y != _path[1].y || _path[0].x != _path[3].x
+       || other._path[0].y != other._path[1].y || other._path[0].x != other._path[3].x )
+    return false;
+  if ( _fillColor == DGtal::Color::None
+       || ! ( _penColor == DGtal::Color::None
+              || ( _penColor == _fillColor && _fillColor.alpha() == 255 ) ) )
+    return false;
+  if ( other._penColor != _penColor || other._fillColor != _fillColor
+       || other._lineWidth != _lineWidth || other._lineStyle != _lineStyle
+       || other._lineCap != _lineCap || other._lineJoin != _lineJoin )
+    return false;
+  if ( ! sameCoordinate( other._path[0].x, _path[1].x )
+       || ! sameCoordinate( other._path[0].y, _path[0].y )
+       || ! sameCoordinate( other._path[3].y, _path[3].y )
+       || ! ( other._path[1].x > other._path[0].x ) )
+    return false;
+  _path[1].x = other._path[1].x;
+  _path[2].x = other._path[1].x;
+  return true;
+}
+
 void
 Rectangle::flushFIG( std::ostream & stream,
                      const TransformFIG & transform,
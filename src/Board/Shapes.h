@@ -993,6 +993,18 @@ struct Rectangle : public Polyline {
    */
   void scaleAll( double s );
 
+  /** 
+   * Extends the rectangle with a rectangle adjacent to its right
+   * side, if both are axis-aligned, have the same height and the same
+   * style, and if the union looks like the two rectangles drawn one
+   * after the other (no pen, or an opaque pen of the fill color).
+   * 
+   * @param other The rectangle to append.
+   * 
+   * @return true if the rectangle was extended, false otherwise.
+   */
+  bool extend( const Rectangle & other );
+
   void flushFIG( std::ostream & stream,
      const TransformFIG & transform,
      std::map<DGtal::Color,int> & colormap ) const;
@@ -1078,6 +1090,87 @@ protected:
 
 
 
+/**
+ * The Raster structure.
+ * @brief An array of colored pixels, embedded in the output file.
+ *
+ * The pixels are written as a single PNG image in SVG files and as a
+ * single colorimage in EPS files, instead of one rectangle per
+ * pixel. Other formats, and EPS files when some pixels are not
+ * opaque, get one rectangle per run of pixels of the same color in a
+ * row.
+ */
+struct Raster : public Rectangle { 
+
+  /** 
+   * Constructs a Raster.
+   * 
+   * @param x First coordinate of the upper left corner.
+   * @param y Second coordinate of the upper left corner.
+   * @param width The width of the raster.
+   * @param height The height of the raster.
+   * @param columns The number of columns of pixels.
+   * @param rows The number of rows of pixels.
+   * @param pixels The colors of the pixels, row by row from the top
+   * row, each row from left to right.
+   * @param depthValue The depth of the raster.
+   */
+  Raster( double x, double y, double width, double height, 
+          unsigned int columns, unsigned int rows,
+          const std::vector<DGtal::Color> & pixels,
+          int depthValue = -1 );
+
+  /** 
+   * Returns the generic name of the shape (e.g., Circle, Rectangle, etc.)
+   * 
+   * @return objet name
+   */
+  const std::string & name() const;
+
+  Raster * clone() const;
+
+  unsigned int columns() const { return _columns; }
+  unsigned int rows() const { return _rows; }
+  const DGtal::Color & pixel( unsigned int column, unsigned int row ) const
+  { return _pixels[ row * _columns + column ]; }
+
+  void flushPostscript( std::ostream & stream,
+      const TransformEPS & transform ) const;
+
+  void flushFIG( std::ostream & stream,
+     const TransformFIG & transform,
+     std::map<DGtal::Color,int> & colormap ) const;
+
+  void flushSVG( std::ostream & stream,
+     const TransformSVG & transform ) const;
+     
+#ifdef WITH_CAIRO
+  void flushCairo( cairo_t *cr,
+     const TransformCairo & transform ) const;
+#endif
+
+  void flushTikZ( std::ostream & stream,
+     const TransformTikZ & transform ) const;
+
+  /** 
+   * Returns one filled polygon per run of pixels of the same color in
+   * a row, fully transparent pixels excepted.
+   * 
+   * @return The runs of the raster.
+   */
+  std::vector<Polyline> runs() const;
+
+private:
+  static const std::string _name; /**< The generic name of the shape. */
+
+protected:
+  unsigned int _columns;
+  unsigned int _rows;
+  std::vector<DGtal::Color> _pixels;
+};
+
+
+
 /**
  * The Triangle structure.
  * @brief A triangle. Basically a Polyline with a convenient constructor.
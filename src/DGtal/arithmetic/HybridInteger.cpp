@@ -0,0 +1,190 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file HybridInteger.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Implementation of methods defined in HybridInteger.h (the slow
+ * paths, which use BigInteger).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/arithmetic/HybridInteger.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+namespace DGtal
+{
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ZERO = 0;
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ONE = 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// class HybridInteger
+///////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger::HybridInteger( unsigned long long v )
+  : mySmall( 0 ), myBig( 0 )
+{
+  if ( v <= (unsigned long long) std::numeric_limits<Small>::max() )
+    mySmall = (Small) v;
+  else
+    { // Built from two 32 bits halves, whatever the size of long.
+      BigInteger b( (unsigned long) ( v >> 32 ) );
+      b <<= 32;
+      b += (unsigned long) ( v & 0xFFFFFFFFULL );
+      assign( b );
+    }
+}
+//-----------------------------------------------------------------------------
+DGtal::BigInteger
+DGtal::HybridInteger::toBig( Small v )
+{
+  // Magnitude in unsigned arithmetic, so that min() does not overflow.
+  const DGtal::uint64_t m = ( v < 0 ) ? 0 - (DGtal::uint64_t) v : (DGtal::uint64_t) v;
+  BigInteger b( (unsigned long) ( m >> 32 ) );
+  b <<= 32;
+  b += (unsigned long) ( m & 0xFFFFFFFFULL );
+  if ( v < 0 ) b = -b;
+  return b;
+}
+//-----------------------------------------------------------------------------
+bool
+DGtal::HybridInteger::fitsSmall( const BigInteger & v )
+{
+  static const BigInteger lowest = toBig( std::numeric_limits<Small>::min() );
+  static const BigInteger highest = toBig( std::numeric_limits<Small>::max() );
+  return ( lowest <= v ) && ( v <= highest );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger::Small
+DGtal::HybridInteger::lowBits( const BigInteger & v )
+{
+  const BigInteger a = abs( v );
+  const BigInteger hi = ( a >> 32 ) & BigInteger( 0xFFFFFFFFUL );
+  const BigInteger lo = a & BigInteger( 0xFFFFFFFFUL );
+  DGtal::uint64_t m = ( (DGtal::uint64_t) hi.get_ui() << 32 ) | (DGtal::uint64_t) lo.get_ui();
+  if ( sgn( v ) < 0 ) m = 0 - m;
+  // Two's complement, without relying on the unsigned to signed cast.
+  return ( m <= (DGtal::uint64_t) std::numeric_limits<Small>::max() )
+    ? (Small) m : - (Small) ( ~m ) - 1;
+}
+//-----------------------------------------------------------------------------
+DGtal::BigInteger
+DGtal::HybridInteger::big() const
+{
+  return ( myBig != 0 ) ? *myBig : toBig( mySmall );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::assign( const BigInteger & v )
+{
+  if ( fitsSmall( v ) )
+    setSmall( lowBits( v ) );
+  else if ( myBig != 0 )
+    *myBig = v;
+  else
+    myBig = new BigInteger( v );
+  return *this;
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::addBig( const HybridInteger & other )
+{
+  return assign( big() + other.big() );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::subBig( const HybridInteger & other )
+{
+  return assign( big() - other.big() );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::mulBig( const HybridInteger & other )
+{
+  return assign( big() * other.big() );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::divBig( const HybridInteger & other )
+{
+  ASSERT( other.sign() != 0 );
+  return assign( big() / other.big() );
+}
+//-----------------------------------------------------------------------------
+DGtal::HybridInteger &
+DGtal::HybridInteger::modBig( const HybridInteger & other )
+{
+  ASSERT( other.sign() != 0 );
+  return assign( big() % other.big() );
+}
+//-----------------------------------------------------------------------------
+int
+DGtal::HybridInteger::compareBig( const HybridInteger & other ) const
+{
+  // Values are normalized: a big value is out of the range of small ones.
+  if ( other.myBig == 0 ) return sgn( *myBig );
+  if ( myBig == 0 )       return - sgn( *other.myBig );
+  return cmp( *myBig, *other.myBig );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+/**
+ * Writes/Displays the object on an output stream.
+ * @param out the output stream where the object is written.
+ */
+void
+DGtal::HybridInteger::selfDisplay ( std::ostream & out ) const
+{
+  if ( myBig != 0 ) out << *myBig;
+  else              out << mySmall;
+}
+
+/**
+ * Checks the validity/consistency of the object.
+ * @return 'true' if the object is valid, 'false' otherwise.
+ */
+bool
+DGtal::HybridInteger::isValid() const
+{
+  return ( myBig == 0 ) || ! fitsSmall( *myBig );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of functions                                               //
+
+std::istream&
+DGtal::operator>> ( std::istream & in, HybridInteger & object )
+{
+  BigInteger v;
+  if ( in >> v ) object = HybridInteger( v );
+  return in;
+}
+
+#endif // WITH_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
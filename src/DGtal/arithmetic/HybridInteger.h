@@ -0,0 +1,418 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HybridInteger.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HybridInteger.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HybridInteger_RECURSES)
+#error Recursive header files inclusion detected in HybridInteger.h
+#else // defined(HybridInteger_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HybridInteger_RECURSES
+
+#if !defined HybridInteger_h
+/** Prevents repeated inclusion of headers. */
+#define HybridInteger_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HybridInteger
+  /**
+   * Description of class 'HybridInteger' <p>
+   * \brief Aim: An exact signed integer that is stored as a
+   * DGtal::int64_t as long as it fits in it, and as a
+   * DGtal::BigInteger otherwise.
+   *
+   * Arithmetical algorithms (IntegerComputer, LatticePolytope2D,
+   * COBANaivePlaneComputer, ArithmeticalDSS, ...) are exact with
+   * BigInteger but pay for a GMP call at every operation, whereas
+   * intermediate values generally fit in 64 bits. With HybridInteger,
+   * each operation on two small values is done on int64_t and checked
+   * for overflow (with compiler builtins when available); only if it
+   * overflows, or if an operand is already big, the operation is
+   * done with BigInteger. Results are normalized: a value that fits
+   * in an int64_t is always stored as an int64_t, so that big values
+   * are short-lived in practice.
+   *
+   * Division and remainder truncate toward zero, as for built-in
+   * integers and BigInteger.
+   *
+   * This class is a model of concepts::CInteger, hence it can be used
+   * as integer type of the arithmetical classes above.
+   *
+   * @code
+   * HybridInteger a( DGtal::int64_t( 1 ) << 62 );
+   * HybridInteger b = a * a;  // exact, stored as a BigInteger
+   * HybridInteger c = b / a;  // back to an int64_t
+   * IntegerComputer<HybridInteger> ic;
+   * HybridInteger g = ic.gcd( b, c );
+   * @endcode
+   *
+   * @note Only available if DGtal has been built with GMP
+   * (WITH_BIGINTEGER defined).
+   *
+   * @see testHybridInteger.cpp
+   */
+  class HybridInteger
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// The type of small values.
+    typedef DGtal::int64_t Small;
+
+    /**
+     * Constructor. The value is 0.
+     */
+    HybridInteger();
+
+    /**
+     * Constructors from built-in integers (implicit conversions).
+     * @param v any integer.
+     */
+    HybridInteger( int v );
+    HybridInteger( long v );
+    HybridInteger( long long v );
+    HybridInteger( unsigned int v );
+    HybridInteger( unsigned long v );
+    HybridInteger( unsigned long long v );
+
+    /**
+     * Constructor from a big integer (implicit conversion).
+     * @param v any big integer.
+     */
+    HybridInteger( const BigInteger & v );
+
+    /**
+     * Destructor.
+     */
+    ~HybridInteger();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    HybridInteger( const HybridInteger & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator=( const HybridInteger & other );
+
+    /**
+     * Move constructor.
+     * @param other the object to move (left equal to 0).
+     */
+    HybridInteger( HybridInteger && other );
+
+    /**
+     * Move assignment.
+     * @param other the object to move (left with some valid value).
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator=( HybridInteger && other );
+
+    /**
+     * Swaps two integers (without allocation).
+     * @param other any integer.
+     */
+    void swap( HybridInteger & other );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return 'true' iff the value fits in a DGtal::int64_t.
+    bool isSmall() const;
+
+    /// @return the value as a DGtal::int64_t. @pre isSmall()
+    Small small() const;
+
+    /// @return the value as a BigInteger.
+    BigInteger big() const;
+
+    /// @return the sign of the value (-1, 0 or 1).
+    int sign() const;
+
+    /// @return the value, truncated to its lowest 64 bits if it is big.
+    DGtal::int64_t castToInt64_t() const;
+
+    /// @return the closest double to the value.
+    double castToDouble() const;
+
+    /// @return 'true' iff the value is even.
+    bool even() const;
+
+    // ----------------------- Arithmetic -------------------------------------
+  public:
+
+    /// @return a copy of 'this'.
+    HybridInteger operator+() const;
+    /// @return the opposite of 'this'.
+    HybridInteger operator-() const;
+
+    /**
+     * Arithmetic assignments.
+     * @param other any integer (non zero for / and %).
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator+=( const HybridInteger & other );
+    HybridInteger & operator-=( const HybridInteger & other );
+    HybridInteger & operator*=( const HybridInteger & other );
+    HybridInteger & operator/=( const HybridInteger & other );
+    HybridInteger & operator%=( const HybridInteger & other );
+
+    /// Pre-increment. @return a reference on 'this'.
+    HybridInteger & operator++();
+    /// Pre-decrement. @return a reference on 'this'.
+    HybridInteger & operator--();
+    /// Post-increment. @return the value before incrementation.
+    HybridInteger operator++( int );
+    /// Post-decrement. @return the value before decrementation.
+    HybridInteger operator--( int );
+
+    /**
+     * Three-way comparison.
+     * @param other any integer.
+     * @return a negative value, 0 or a positive value when 'this' is
+     * respectively smaller, equal or greater than @a other.
+     */
+    int compare( const HybridInteger & other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object: a big value
+     * never fits in a DGtal::int64_t.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The value when it fits in an int64_t.
+    Small mySmall;
+
+    /// The value otherwise (owned), 0 when the value is small.
+    BigInteger* myBig;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Sets the value from a big integer, which is stored as a small
+     * value whenever it fits in an int64_t.
+     * @param v any big integer.
+     * @return a reference on 'this'.
+     */
+    HybridInteger & assign( const BigInteger & v );
+
+    /// Sets a small value, releasing the big one if any.
+    void setSmall( Small v );
+
+    /*
+     * Conversions between Small and BigInteger. They go through
+     * 32 bits halves, since long (used by the BigInteger interface)
+     * may have only 32 bits (e.g. on Windows).
+     */
+    /// @return the big integer equal to @a v.
+    static BigInteger toBig( Small v );
+    /// @return 'true' iff @a v fits in a Small.
+    static bool fitsSmall( const BigInteger & v );
+    /// @return the lowest 64 bits of @a v (two's complement).
+    static Small lowBits( const BigInteger & v );
+
+    /// Slow path of operator+=.
+    HybridInteger & addBig( const HybridInteger & other );
+    /// Slow path of operator-=.
+    HybridInteger & subBig( const HybridInteger & other );
+    /// Slow path of operator*=.
+    HybridInteger & mulBig( const HybridInteger & other );
+    /// Slow path of operator/=.
+    HybridInteger & divBig( const HybridInteger & other );
+    /// Slow path of operator%=.
+    HybridInteger & modBig( const HybridInteger & other );
+    /// Slow path of compare.
+    int compareBig( const HybridInteger & other ) const;
+
+  }; // end of class HybridInteger
+
+
+  /**
+   * Arithmetic operators. Two small operands whose result fits in
+   * an int64_t never allocate.
+   * @param a any integer.
+   * @param b any integer (non zero for / and %).
+   * @return the result of the operation.
+   */
+  HybridInteger operator+( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator-( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator*( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator/( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator%( const HybridInteger & a, const HybridInteger & b );
+
+  /**
+   * Comparison operators.
+   * @param a any integer.
+   * @param b any integer.
+   * @return the result of the comparison.
+   */
+  bool operator==( const HybridInteger & a, const HybridInteger & b );
+  bool operator!=( const HybridInteger & a, const HybridInteger & b );
+  bool operator<( const HybridInteger & a, const HybridInteger & b );
+  bool operator<=( const HybridInteger & a, const HybridInteger & b );
+  bool operator>( const HybridInteger & a, const HybridInteger & b );
+  bool operator>=( const HybridInteger & a, const HybridInteger & b );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HybridInteger'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HybridInteger' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const HybridInteger & object );
+
+  /**
+   * Overloads 'operator>>' for reading objects of class 'HybridInteger'.
+   * @param in the input stream.
+   * @param object (modified) the read integer.
+   * @return the input stream after the reading.
+   */
+  std::istream&
+  operator>> ( std::istream & in, HybridInteger & object );
+
+  /**
+   * Specialization for DGtal::HybridInteger. As DGtal::BigInteger,
+   * it is an unbounded integer type.
+   */
+  template <>
+  struct NumberTraits<DGtal::HybridInteger>
+  {
+    typedef TagTrue IsIntegral;
+    typedef TagFalse IsBounded;
+    typedef TagTrue IsUnsigned;
+    typedef TagTrue IsSigned;
+    typedef TagTrue IsSpecialized;
+    typedef DGtal::HybridInteger SignedVersion;
+    typedef DGtal::HybridInteger UnsignedVersion;
+    typedef DGtal::HybridInteger ReturnType;
+    typedef DGtal::HybridInteger ParamType;
+    static const DGtal::HybridInteger ZERO;
+    static const DGtal::HybridInteger ONE;
+    static ReturnType zero()
+    {
+      return ZERO;
+    }
+    static ReturnType one()
+    {
+      return ONE;
+    }
+    static ReturnType min()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support min() function");
+      return ZERO;
+    }
+    static ReturnType max()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support max() function");
+      return ZERO;
+    }
+    static unsigned int digits()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support digits() function");
+      return 0;
+    }
+    static BoundEnum isBounded()
+    {
+      return BOUNDED;
+    }
+    static SignEnum isSigned()
+    {
+      return SIGNED;
+    }
+    static DGtal::int64_t castToInt64_t(const DGtal::HybridInteger & aT)
+    {
+      return aT.castToInt64_t();
+    }
+    static double castToDouble(const DGtal::HybridInteger & aT)
+    {
+      return aT.castToDouble();
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is even.
+    */
+    static bool even( const DGtal::HybridInteger & aT )
+    {
+      return aT.even();
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is odd.
+    */
+    static bool odd( const DGtal::HybridInteger & aT )
+    {
+      return ! aT.even();
+    }
+  }; // end of class NumberTraits<DGtal::HybridInteger>.
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/HybridInteger.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // WITH_BIGINTEGER
+
+#endif // !defined HybridInteger_h
+
+#undef HybridInteger_RECURSES
+#endif // else defined(HybridInteger_RECURSES)
@@ -44,6 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/StdRebinders.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
@@ -102,6 +104,11 @@ namespace DGtal
 
    @tparam TMap the rebinder type for defining an association TQuotient ->
    LighterSternBrocot::Node*. For instance, StdMapRebinder is fine.
+
+   The tree may be used concurrently by several threads: the children
+   maps of each node are protected by one of a fixed set of mutexes
+   (chosen from the node address) and new nodes are allocated in an
+   arena owned by the tree.
   */
   template <typename TInteger, typename TQuotient, 
             typename TMap = StdMapRebinder >
@@ -550,6 +557,15 @@ namespace DGtal
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// Number of mutexes protecting the children maps of the nodes.
+    static const unsigned int NbNodeMutexes = 64;
+    /// Arena of the nodes of the tree (addresses are stable).
+    std::deque<Node> myNodes;
+    /// Protects node creation, myNodes and nbFractions.
+    std::mutex myMutex;
+    /// The children maps of a node are protected by one of these mutexes.
+    std::mutex myNodeMutexes[ NbNodeMutexes ];
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -578,6 +594,23 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       @param n any node.
+       @return the mutex protecting the children maps of \a n.
+    */
+    std::mutex & nodeMutex( const Node* n );
+
+    /**
+       Creates a node in the arena of the tree (thread-safe).
+       @param p1 the numerator.
+       @param q1 the denominator.
+       @param u1 the quotient (last coefficient of its continued fraction).
+       @param k1 the depth (1+number of coefficients of its continued fraction).
+       @param link the ascendant (resp. origin) node.
+       @return the new node.
+    */
+    Node* newNode( Integer p1, Integer q1, Quotient u1, Quotient k1, Node* link );
+
   }; // end of class LighterSternBrocot
 
 
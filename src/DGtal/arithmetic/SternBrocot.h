@@ -44,6 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -67,6 +70,12 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be used concurrently by several threads: the
+   descendants of a node are published through atomic pointers, so
+   that navigating in the already built part of the tree takes no
+   lock, and new nodes are created under a mutex and allocated in an
+   arena owned by the tree.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -131,9 +140,9 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -471,6 +480,11 @@ namespace DGtal
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// Arena of the nodes of the tree (addresses are stable).
+    std::deque<Node> myNodes;
+    /// Protects node creation, myNodes and nbFractions.
+    std::mutex myMutex;
+
     // ------------------------- Hidden services ------------------------------
   private:
 
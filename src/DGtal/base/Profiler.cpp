@@ -0,0 +1,289 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Profiler.cpp
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Implementation of methods defined in Profiler.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Profiler.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <algorithm>
+#include <cstdio>
+#include "DGtal/base/Common.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// class Profiler
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// Serial numbers of the profilers (0 is never used).
+  std::atomic<unsigned long> profilerSerials( 0 );
+
+  /// Buffer of the calling thread in the last profiler it used.
+  thread_local unsigned long threadProfilerSerial = 0;
+  thread_local void* threadProfilerBuffer = 0;
+
+  /// Writes @a name as a JSON string.
+  void writeJSONString( std::ostream & out, const char* name )
+  {
+    out << '"';
+    for ( const char* c = name; *c; ++c )
+      {
+        if ( *c == '"' || *c == '\\' )
+          out << '\\' << *c;
+        else if ( (unsigned char) *c < 0x20 )
+          {
+            char code[ 8 ];
+            std::sprintf( code, "\\u%04x", (unsigned int) (unsigned char) *c );
+            out << code;
+          }
+        else
+          out << *c;
+      }
+    out << '"';
+  }
+
+  /// Writes @a name as a CSV field.
+  void writeCSVField( std::ostream & out, const std::string & name )
+  {
+    if ( name.find_first_of( ",\"\n" ) == std::string::npos )
+      {
+        out << name;
+        return;
+      }
+    out << '"';
+    for ( std::size_t i = 0; i < name.size(); ++i )
+      out << ( name[ i ] == '"' ? "\"\"" : std::string( 1, name[ i ] ) );
+    out << '"';
+  }
+}
+
+namespace DGtal
+{
+  Profiler profiler;
+}
+
+//-----------------------------------------------------------------------------
+DGtal::Profiler::Profiler()
+  : myOrigin( now() ), mySerial( ++profilerSerials )
+{}
+//-----------------------------------------------------------------------------
+DGtal::Profiler::~Profiler()
+{
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    delete myBuffers[ i ];
+}
+//-----------------------------------------------------------------------------
+DGtal::Profiler::ThreadBuffer &
+DGtal::Profiler::threadBuffer()
+{
+  if ( threadProfilerSerial == mySerial )
+    return *static_cast<ThreadBuffer*>( threadProfilerBuffer );
+  std::lock_guard<std::mutex> lock( myMutex );
+  const std::thread::id id = std::this_thread::get_id();
+  ThreadBuffer* buffer = 0;
+  for ( std::size_t i = 0; i < myBuffers.size() && ! buffer; ++i )
+    if ( myBuffers[ i ]->threadId == id )
+      buffer = myBuffers[ i ];
+  if ( ! buffer )
+    {
+      buffer = new ThreadBuffer;
+      buffer->threadId = id;
+      buffer->index = (unsigned int) myBuffers.size();
+      myBuffers.push_back( buffer );
+    }
+  threadProfilerSerial = mySerial;
+  threadProfilerBuffer = buffer;
+  return *buffer;
+}
+//-----------------------------------------------------------------------------
+bool
+DGtal::Profiler::noOpenZone( bool allThreads ) const
+{
+  const std::thread::id id = std::this_thread::get_id();
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    if ( ! myBuffers[ i ]->openZones.empty()
+         && ( allThreads || myBuffers[ i ]->threadId != id ) )
+      return false;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void
+DGtal::Profiler::clear()
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( true ), "Profiler::clear() while a zone is open" );
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    {
+      myBuffers[ i ]->zones.clear();
+      myBuffers[ i ]->openZones.clear();
+      myBuffers[ i ]->counters.clear();
+      myBuffers[ i ]->names.clear();
+    }
+  myOrigin = now();
+}
+//-----------------------------------------------------------------------------
+unsigned int
+DGtal::Profiler::nbThreads() const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( false ), "Profiler output while another thread is recording" );
+  unsigned int nb = 0;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    if ( ! myBuffers[ i ]->zones.empty() || ! myBuffers[ i ]->counters.empty() )
+      ++nb;
+  return nb;
+}
+//-----------------------------------------------------------------------------
+std::vector<DGtal::Profiler::Zone>
+DGtal::Profiler::zones() const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( false ), "Profiler output while another thread is recording" );
+  std::vector<Zone> result;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    result.insert( result.end(), myBuffers[ i ]->zones.begin(), myBuffers[ i ]->zones.end() );
+  return result;
+}
+//-----------------------------------------------------------------------------
+std::map<std::string, DGtal::Profiler::ZoneStatistics>
+DGtal::Profiler::zoneStatistics() const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( false ), "Profiler output while another thread is recording" );
+  std::map<std::string, ZoneStatistics> result;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    for ( std::size_t j = 0; j < myBuffers[ i ]->zones.size(); ++j )
+      {
+        const Zone & zone = myBuffers[ i ]->zones[ j ];
+        if ( zone.end == 0 ) continue;
+        ZoneStatistics & stat = result[ zone.name ];
+        const Time duration = zone.end - zone.start;
+        stat.nbCalls += 1;
+        stat.totalTime += duration;
+        stat.maxTime = std::max( stat.maxTime, duration );
+      }
+  return result;
+}
+//-----------------------------------------------------------------------------
+std::map<std::string, DGtal::Profiler::Count>
+DGtal::Profiler::counters() const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( false ), "Profiler output while another thread is recording" );
+  std::map<std::string, Count> result;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    for ( std::size_t j = 0; j < myBuffers[ i ]->counters.size(); ++j )
+      result[ myBuffers[ i ]->counters[ j ].first ] += myBuffers[ i ]->counters[ j ].second;
+  return result;
+}
+//-----------------------------------------------------------------------------
+void
+DGtal::Profiler::exportChromeTrace( std::ostream & out ) const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  ASSERT_MSG( noOpenZone( false ), "Profiler output while another thread is recording" );
+  const Time end = now() - myOrigin;
+  const std::streamsize precision = out.precision( 3 );
+  const std::ios_base::fmtflags flags = out.setf( std::ios_base::fixed, std::ios_base::floatfield );
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    {
+      const ThreadBuffer & buffer = *myBuffers[ i ];
+      for ( std::size_t j = 0; j < buffer.zones.size(); ++j )
+        {
+          const Zone & zone = buffer.zones[ j ];
+          const Time zoneEnd = ( zone.end == 0 ) ? end : zone.end;
+          out << ( first ? "\n" : ",\n" ) << "{\"name\":";
+          writeJSONString( out, zone.name );
+          out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer.index
+              << ",\"ts\":" << zone.start / 1000.0
+              << ",\"dur\":" << ( zoneEnd - zone.start ) / 1000.0 << "}";
+          first = false;
+        }
+      for ( std::size_t j = 0; j < buffer.counters.size(); ++j )
+        {
+          out << ( first ? "\n" : ",\n" ) << "{\"name\":";
+          writeJSONString( out, buffer.counters[ j ].first );
+          out << ",\"ph\":\"C\",\"pid\":0,\"tid\":" << buffer.index
+              << ",\"ts\":" << end / 1000.0
+              << ",\"args\":{\"value\":" << buffer.counters[ j ].second << "}}";
+          first = false;
+        }
+    }
+  out << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+  out.precision( precision );
+  out.flags( flags );
+}
+//-----------------------------------------------------------------------------
+void
+DGtal::Profiler::exportCSV( std::ostream & out ) const
+{
+  const std::map<std::string, ZoneStatistics> stats = zoneStatistics();
+  const std::map<std::string, Count> values = counters();
+  out << "kind,name,calls,total_ns,max_ns,value" << std::endl;
+  for ( std::map<std::string, ZoneStatistics>::const_iterator it = stats.begin();
+        it != stats.end(); ++it )
+    {
+      out << "zone,";
+      writeCSVField( out, it->first );
+      out << "," << it->second.nbCalls << "," << it->second.totalTime
+          << "," << it->second.maxTime << "," << std::endl;
+    }
+  for ( std::map<std::string, Count>::const_iterator it = values.begin();
+        it != values.end(); ++it )
+    {
+      out << "counter,";
+      writeCSVField( out, it->first );
+      out << ",,,," << it->second << std::endl;
+    }
+}
+//-----------------------------------------------------------------------------
+void
+DGtal::Profiler::selfDisplay( std::ostream & out ) const
+{
+  std::lock_guard<std::mutex> lock( myMutex );
+  std::size_t nbZones = 0;
+  std::size_t nbCounters = 0;
+  for ( std::size_t i = 0; i < myBuffers.size(); ++i )
+    {
+      nbZones += myBuffers[ i ]->zones.size();
+      nbCounters += myBuffers[ i ]->counters.size();
+    }
+  out << "[Profiler #threads=" << myBuffers.size() << " #zones=" << nbZones
+      << " #counters=" << nbCounters << "]";
+}
+//-----------------------------------------------------------------------------
+bool
+DGtal::Profiler::isValid() const
+{
+  return mySerial != 0;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
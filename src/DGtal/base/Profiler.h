@@ -0,0 +1,360 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Profiler.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module Profiler.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Profiler_RECURSES)
+#error Recursive header files inclusion detected in Profiler.h
+#else // defined(Profiler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Profiler_RECURSES
+
+#if !defined Profiler_h
+/** Prevents repeated inclusion of headers. */
+#define Profiler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <boost/cstdint.hpp>
+#include "DGtal/base/Config.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Profiler
+  /**
+   * Description of class 'Profiler' <p>
+   * \brief Aim: Records timed zones and counters from any thread with a
+   * low overhead, and exports them as a Chrome trace (chrome://tracing,
+   * Perfetto) or as CSV statistics.
+   *
+   * Each thread records its zones in its own buffer (found through a
+   * thread-local pointer), so that recording never locks once the
+   * buffer of the thread exists. Times are given by a monotonic clock
+   * in nanoseconds. Counters (voxels processed, cache misses...) are
+   * summed per thread.
+   *
+   * The library is instrumented with the macros DGTAL_PROFILE_ZONE and
+   * DGTAL_PROFILE_COUNT, which record in the global object
+   * DGtal::profiler and compile to nothing unless DGtal is configured
+   * with DGTAL_ENABLE_PROFILER (in which case Trace::beginBlock and
+   * Trace::endBlock also open and close zones).
+   *
+   * @code
+   * void process()
+   * {
+   *   DGTAL_PROFILE_ZONE( "process" );
+   *   ...
+   *   DGTAL_PROFILE_COUNT( "voxels", nbVoxels );
+   * }
+   * ...
+   * std::ofstream out( "trace.json" );
+   * DGtal::profiler.exportChromeTrace( out );
+   * @endcode
+   *
+   * Exports, statistics and clear() read the buffers of the other
+   * threads without synchronizing with them: they must not be called
+   * while other threads are recording. This is asserted (in debug
+   * mode) by checking that no zone is open on another thread, and on
+   * any thread for clear().
+   *
+   * @see testProfiler.cpp
+   */
+  class Profiler
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef boost::uint64_t Time;
+    typedef boost::int64_t Count;
+
+    /// A recorded zone, times in ns since the profiler origin.
+    struct Zone
+    {
+      const char* name;
+      Time start;
+      Time end;
+      unsigned int depth;
+    };
+
+    /// Statistics of all the zones with the same name.
+    struct ZoneStatistics
+    {
+      Count nbCalls;
+      Time totalTime;
+      Time maxTime;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     */
+    Profiler();
+
+    /**
+     * Destructor.
+     */
+    ~Profiler();
+
+    // ----------------------- Recording services -----------------------------
+  public:
+
+    /**
+     * @return the time of a monotonic clock, in nanoseconds.
+     */
+    static Time now();
+
+    /**
+     * Opens a zone in the calling thread.
+     * @param name the zone name, which must outlive the profiler (a
+     * string literal).
+     */
+    void beginZone( const char* name );
+
+    /**
+     * Opens a zone in the calling thread.
+     * @param name the zone name (copied).
+     */
+    void beginZone( const std::string & name );
+
+    /**
+     * Closes the last zone opened by the calling thread.
+     */
+    void endZone();
+
+    /**
+     * Adds a value to a counter of the calling thread.
+     * @param name the counter name, which must outlive the profiler (a
+     * string literal).
+     * @param value the value to add.
+     */
+    void count( const char* name, Count value );
+
+    /**
+     * Removes all the recorded zones and counters, and restarts the
+     * time origin.
+     * @pre no thread is recording and no zone is open on any thread
+     * (asserted for open zones).
+     */
+    void clear();
+
+    // ----------------------- Output services --------------------------------
+  public:
+    // The following services require that no other thread is
+    // recording (asserted for open zones). Zones still open on the
+    // calling thread are exported until now.
+
+    /**
+     * @return the number of threads which have recorded something.
+     */
+    unsigned int nbThreads() const;
+
+    /**
+     * @return the zones recorded by all the threads, thread after thread.
+     */
+    std::vector<Zone> zones() const;
+
+    /**
+     * @return the statistics of the closed zones, by name.
+     */
+    std::map<std::string, ZoneStatistics> zoneStatistics() const;
+
+    /**
+     * @return the counters summed over all the threads, by name.
+     */
+    std::map<std::string, Count> counters() const;
+
+    /**
+     * Writes the zones (complete events) and the counters (counter
+     * events) in the Chrome trace event JSON format.
+     * @param out the output stream.
+     */
+    void exportChromeTrace( std::ostream & out ) const;
+
+    /**
+     * Writes one CSV line per zone name
+     * (zone,name,calls,total_ns,max_ns,) and per counter
+     * (counter,name,,,,value), after a header line.
+     * @param out the output stream.
+     */
+    void exportCSV( std::ostream & out ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The recording state of one thread.
+    struct ThreadBuffer
+    {
+      std::thread::id threadId;
+      unsigned int index;
+      std::vector<Zone> zones;
+      std::vector<std::size_t> openZones;
+      std::vector< std::pair<const char*, Count> > counters;
+      std::deque<std::string> names;
+    };
+
+    /// Protects myBuffers.
+    mutable std::mutex myMutex;
+    /// The buffers of the threads (owned).
+    std::vector<ThreadBuffer*> myBuffers;
+    /// The time origin.
+    Time myOrigin;
+    /// A number identifying this profiler among all the profilers.
+    unsigned long mySerial;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @return the buffer of the calling thread, created if needed.
+     */
+    ThreadBuffer & threadBuffer();
+
+    /**
+     * Must be called with myMutex locked.
+     * @param allThreads when 'false', the zones open on the calling
+     * thread are ignored.
+     * @return 'true' if no zone is open on the checked threads.
+     */
+    bool noOpenZone( bool allThreads ) const;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Profiler( const Profiler & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Profiler & operator= ( const Profiler & other );
+
+  }; // end of class Profiler
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Profiler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Profiler' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const Profiler & object );
+
+  /// The global profiler used by DGTAL_PROFILE_ZONE and DGTAL_PROFILE_COUNT.
+  extern Profiler profiler;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ProfilerZone
+  /**
+   * Description of class 'ProfilerZone' <p>
+   * \brief Aim: Opens a zone of the global profiler at construction
+   * and closes it at destruction.
+   */
+  class ProfilerZone
+  {
+  public:
+    /**
+     * Constructor.
+     * @param name the zone name (a string literal).
+     */
+    explicit ProfilerZone( const char* name )
+    {
+      profiler.beginZone( name );
+    }
+
+    /**
+     * Destructor.
+     */
+    ~ProfilerZone()
+    {
+      profiler.endZone();
+    }
+
+  private:
+    ProfilerZone( const ProfilerZone & other );
+    ProfilerZone & operator= ( const ProfilerZone & other );
+  }; // end of class ProfilerZone
+
+} // namespace DGtal
+
+/// Concatenation helpers for unique variable names.
+#define DGTAL_PROFILER_CAT_( a, b ) a ## b
+#define DGTAL_PROFILER_CAT( a, b ) DGTAL_PROFILER_CAT_( a, b )
+
+#ifdef DGTAL_ENABLE_PROFILER
+/// Records a zone from this line to the end of the enclosing scope.
+#define DGTAL_PROFILE_ZONE( name ) \
+  DGtal::ProfilerZone DGTAL_PROFILER_CAT( dgtalProfilerZone, __LINE__ )( name )
+/// Adds @a value to the counter @a name.
+#define DGTAL_PROFILE_COUNT( name, value ) \
+  DGtal::profiler.count( name, (DGtal::Profiler::Count) ( value ) )
+#else
+#define DGTAL_PROFILE_ZONE( name ) ((void) 0)
+#define DGTAL_PROFILE_COUNT( name, value ) ((void) 0)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/Profiler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Profiler_h
+
+#undef Profiler_RECURSES
+#endif // else defined(Profiler_RECURSES)
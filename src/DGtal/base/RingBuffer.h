@@ -0,0 +1,215 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RingBuffer.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module RingBuffer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RingBuffer_RECURSES)
+#error Recursive header files inclusion detected in RingBuffer.h
+#else // defined(RingBuffer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RingBuffer_RECURSES
+
+#if !defined RingBuffer_h
+/** Prevents repeated inclusion of headers. */
+#define RingBuffer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RingBuffer
+  /**
+     Description of template class 'RingBuffer' <p> \brief Aim: A
+     first-in first-out queue stored in a circular array.
+
+     It offers the services of std::queue (push, pop, front, back,
+     empty, size), but its storage is a single array whose capacity
+     is a power of two and is doubled when full. Contrary to the
+     std::deque behind std::queue, clear() keeps the storage: a queue
+     that is cleared and filled again up to the same size does not
+     allocate memory anymore. It is the node queue of
+     BreadthFirstVisitor.
+
+     @tparam T the type of stored values, which must be default
+     constructible and assignable.
+   */
+  template <typename T>
+  class RingBuffer
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef RingBuffer<T> Self;
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T & reference;
+    typedef const T & const_reference;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param capacity the number of values that may be stored before
+     * the first allocation (rounded to the next power of two).
+     */
+    RingBuffer( size_type capacity = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~RingBuffer();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    RingBuffer( const RingBuffer & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    RingBuffer & operator=( const RingBuffer & other );
+
+    /**
+     * Swaps the content of 'this' with the one of @a other. O(1).
+     * @param other any other ring buffer.
+     */
+    void swap( RingBuffer & other );
+
+    // ----------------------- Queue services ---------------------------------
+  public:
+
+    /// @return 'true' iff the queue is empty.
+    bool empty() const;
+
+    /// @return the number of values in the queue.
+    size_type size() const;
+
+    /// @return the number of values that can be stored without allocation.
+    size_type capacity() const;
+
+    /**
+     * Makes room for @a n values (rounded to the next power of two).
+     * @param n the requested capacity.
+     */
+    void reserve( size_type n );
+
+    /// @return a reference on the oldest value. NB: the queue must not be empty.
+    reference front();
+    /// @return a const reference on the oldest value. NB: the queue must not be empty.
+    const_reference front() const;
+    /// @return a reference on the newest value. NB: the queue must not be empty.
+    reference back();
+    /// @return a const reference on the newest value. NB: the queue must not be empty.
+    const_reference back() const;
+
+    /**
+     * Inserts a value at the end of the queue. Amortized O(1).
+     * @param v any value.
+     */
+    void push( const value_type & v );
+
+    /**
+     * Removes the oldest value. NB: the queue must not be empty.
+     */
+    void pop();
+
+    /**
+     * Empties the queue, without releasing its storage. O(1).
+     */
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The circular storage, whose size is zero or a power of two.
+    std::vector<T> myData;
+    /// The position of the oldest value in myData.
+    size_type myHead;
+    /// The number of values in the queue.
+    size_type mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Moves the values in a storage of size @a n, the oldest one at 0.
+     * @param n the new size of the storage (a power of two, at least size()).
+     */
+    void reallocate( size_type n );
+
+  }; // end of class RingBuffer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RingBuffer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RingBuffer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const RingBuffer<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/RingBuffer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RingBuffer_h
+
+#undef RingBuffer_RECURSES
+#endif // else defined(RingBuffer_RECURSES)
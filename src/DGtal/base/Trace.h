@@ -46,6 +46,7 @@
 
 #include "DGtal/base/Config.h"
 #include "DGtal/base/Clock.h"
+#include "DGtal/base/Profiler.h"
 #include "DGtal/base/TraceWriter.h"
 #include "DGtal/base/TraceWriterTerm.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -186,7 +187,7 @@ namespace DGtal
     TraceWriter &myWriter;
 
     ///A stack to store the block clocks
-    std::stack<Clock*> myClockStack;
+    std::stack<Clock> myClockStack;
 
     ///Progress bar current position
     int myProgressBarCurrent;
@@ -44,6 +44,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <utility>
 #include <boost/array.hpp>
 #include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
@@ -87,6 +88,15 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Operator matrices are assembled in parallel (when DGtal is built
+   * with OpenMP), directly in compressed storage, and memoized:
+   * derivative(), hodge() and laplace() compute their matrix at the
+   * first call and return the cached one until the structure is
+   * modified (insertSCell(), eraseCell(), resetSizes(), updateIndexes()
+   * or non-const iteration over the cell properties). As for sharp()
+   * and flat(), the first call of an operator must not happen
+   * concurrently with other calls on the same calculus.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -561,6 +571,28 @@ namespace DGtal
      */
     bool myCachedOperatorsNeedUpdate;
 
+    /**
+     * Cached derivative operator matrices, indexed by duality and input order.
+     */
+    mutable boost::array<boost::array<SparseMatrix, dimEmbedded+1>, 2> myDerivativeMatrixes;
+
+    /**
+     * Cached hodge operator matrices, indexed by duality and input order.
+     */
+    mutable boost::array<boost::array<SparseMatrix, dimEmbedded+1>, 2> myHodgeMatrixes;
+
+    /**
+     * Cached laplace operator matrices, indexed by duality.
+     */
+    mutable boost::array<SparseMatrix, 2> myLaplaceMatrixes;
+
+    /**
+     * Cached derivative, hodge and laplace operators validity flags.
+     */
+    mutable boost::array<boost::array<bool, dimEmbedded+1>, 2> myDerivativeMatrixesValid;
+    mutable boost::array<boost::array<bool, dimEmbedded+1>, 2> myHodgeMatrixesValid;
+    mutable boost::array<bool, 2> myLaplaceMatrixesValid;
+
     /**
      * Indexes generation flag.
      */
@@ -573,6 +605,84 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Column indexes and values of the nonzero coefficients of a matrix row.
+     */
+    typedef std::vector< std::pair<Index, Scalar> > RowEntries;
+
+    /**
+     * Member function appending the entries of one row of an operator matrix.
+     * Its arguments are the row index, the direction (for flat and sharp
+     * operators only) and the entries to append to.
+     */
+    typedef void (Self::*RowBuilder)(const Index, const Dimension, RowEntries&) const;
+
+    /**
+     * Mark all cached operators as outdated.
+     */
+    void
+    invalidateCachedOperators();
+
+    /**
+     * Assemble an operator matrix row by row.
+     * Rows are computed in parallel by chunks, then the exact number of
+     * nonzero coefficients of each column is known and the compressed
+     * matrix is filled without sorting triplets.
+     * @param rows number of rows.
+     * @param cols number of columns.
+     * @param row_builder member function computing the entries of a row.
+     * @param direction direction forwarded to @a row_builder.
+     * @return assembled matrix.
+     */
+    SparseMatrix
+    assembleRows(const Index rows, const Index cols, RowBuilder row_builder, const Dimension direction) const;
+
+    /**
+     * Entries of a derivative operator row.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param index_output output (order+1)-form index.
+     * @param direction unused.
+     * @param entries entries to append to.
+     */
+    template <Order order, Duality duality>
+    void
+    derivativeRow(const Index index_output, const Dimension direction, RowEntries& entries) const;
+
+    /**
+     * Entries of a hodge operator row.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param index k-form index.
+     * @param direction unused.
+     * @param entries entries to append to.
+     */
+    template <Order order, Duality duality>
+    void
+    hodgeRow(const Index index, const Dimension direction, RowEntries& entries) const;
+
+    /**
+     * Entries of a directional flat operator row.
+     * @tparam duality duality of the operator.
+     * @param edge_index output 1-form index.
+     * @param direction direction of the operator.
+     * @param entries entries to append to.
+     */
+    template <Duality duality>
+    void
+    flatRow(const Index edge_index, const Dimension direction, RowEntries& entries) const;
+
+    /**
+     * Entries of a directional sharp operator row.
+     * @tparam duality duality of the operator.
+     * @param point_index output 0-form index.
+     * @param direction direction of the operator.
+     * @param entries entries to append to.
+     */
+    template <Duality duality>
+    void
+    sharpRow(const Index point_index, const Dimension direction, RowEntries& entries) const;
+
     /**
      * Update sharp and flat operators cache.
      */
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 #include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/shapes/MeshHelpers.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -77,6 +78,7 @@ public:
 
     /**
      * Create a DEC structure from digital set.
+     * The cells around the points of the set are enumerated and counted in parallel.
      * DEC embedded and ambient dimensions are equal to digital set point dimension.
      * Points of the set get attached to primal n-cell <-> dual 0-cell.
      * @tparam TDigitalSet type of digital set passed as argument. must be a model of concepts::CDigitalSet.
@@ -92,6 +94,7 @@ public:
      * Create a DEC structure from a range of signed n-cells, where n is the embedded dimension.
 		 * Signed n-cells may live in an ambient Khamlisky space with dimension greater than n.
      * N-cells get attached to primal n-cell <-> dual 0-cell. See section \ref sectDECEmbedding for more information.
+     * Lower incident cells of the n-cells (e.g. of the surfels of a DigitalSurface) are enumerated and counted in parallel.
      * @tparam dimEmbedded dimension of emmbedded manifold. All input n-cells must have their dimension equal to dimEmbedded.
      * @tparam TNSCellConstIterator signed cells collection const iterator type.
      * @param begin beginning of iteration range.
@@ -143,6 +146,34 @@ protected:
     void
     accumulateAllLowerIncidentCells(const KSpace& kspace, const typename CellsAccum::key_type& cell, CellsAccum& cells_accum);
 
+    /**
+     * Append recursively all lower incident cells to a cell list, starting from cell.
+     * A cell is appended once for each path of lower incidences leading to it,
+     * as accumulateAllLowerIncidentCells counts it.
+     * Internal use only.
+     * @tparam KSpace Khalimsky space type.
+     * @param kspace Khalimsky space instance.
+     * @param cell starting cell.
+     * @param cells cell list to which lower incident cells get appended.
+     */
+    template <typename KSpace>
+    static
+    void
+    appendAllLowerIncidentCells(const KSpace& kspace, const typename KSpace::Cell& cell, std::vector<typename KSpace::Cell>& cells);
+
+    /**
+     * Count the occurrences of each cell in a cell list.
+     * Cells are numbered in parallel by hashing their Khalimsky coordinates (see MeshHelpers::weldKeys).
+     * Internal use only.
+     * @tparam Cell Khalimsky cell type.
+     * @param cells cells, possibly repeated.
+     * @return distinct cells, sorted as in std::map<Cell, int>, with their number of occurrences.
+     */
+    template <typename Cell>
+    static
+    std::vector< std::pair<Cell, int> >
+    countCells(const std::vector<Cell>& cells);
+
 private:
 
     /**
@@ -58,6 +58,16 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * The factorization (or preconditioner) computed by compute() is
+   * kept for all the subsequent solves. For time-dependent problems,
+   * factorize() recomputes it for a new operator with the same
+   * structure (e.g. a new time step) without redoing the symbolic
+   * analysis. Solves can write in an existing k-form, start from an
+   * initial guess (iterative backends only; direct backends ignore
+   * it), and process a block of k-forms stored as the columns of a
+   * dense matrix, which lets direct backends run their triangular
+   * solves on all the right-hand sides at once.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -81,6 +91,7 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
 
     /**
      * Constructor.
@@ -119,6 +130,44 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Refactorize problem with a new operator whose sparsity pattern
+     * is the one of the operator given to compute.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& factorize(const Operator& linear_operator);
+
+    /**
+     * Solve prefactorized / set problem input in place.
+     * @param input_kform input k-form.
+     * @param[out] solution_kform problem solution, its storage is reused.
+     */
+    void solve(const InputKForm& input_kform, SolutionKForm& solution_kform) const;
+
+    /**
+     * Solve prefactorized / set problem input, starting from an initial
+     * guess if the linear algebra solver is iterative.
+     * @param input_kform input k-form.
+     * @param[in,out] solution_kform initial guess, replaced by the problem solution.
+     */
+    void solveWithGuess(const InputKForm& input_kform, SolutionKForm& solution_kform) const;
+
+    /**
+     * Solve prefactorized / set problem for a block of inputs.
+     * @param inputs input k-forms containers, one per column.
+     * @param[out] solutions problem solutions, one per column, its storage is reused.
+     */
+    void solve(const DenseMatrix& inputs, DenseMatrix& solutions) const;
+
+    /**
+     * Solve prefactorized / set problem for a block of inputs, starting
+     * from initial guesses if the linear algebra solver is iterative.
+     * @param inputs input k-forms containers, one per column.
+     * @param[in,out] solutions initial guesses, replaced by the problem solutions.
+     */
+    void solveWithGuess(const DenseMatrix& inputs, DenseMatrix& solutions) const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -134,6 +183,20 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Solves with the solveWithGuess method of the linear algebra solver.
+     * Selected by overload resolution when this method exists.
+     */
+    template <typename Solver, typename Input, typename Solution>
+    static auto solveFromGuess(const Solver& solver, const Input& input, Solution& solution, int)
+      -> decltype(solver.solveWithGuess(input, solution), void());
+
+    /**
+     * Solves without guess, for linear algebra solvers without solveWithGuess method.
+     */
+    template <typename Solver, typename Input, typename Solution>
+    static void solveFromGuess(const Solver& solver, const Input& input, Solution& solution, long);
+
   }; // end of class DiscreteExteriorCalculusSolver
 
 
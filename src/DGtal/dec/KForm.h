@@ -115,6 +115,12 @@ namespace DGtal
      */
     KForm(ConstAlias<Calculus> calculus, const Container& container);
 
+    /**
+     * Copy constructor.
+     * @param other the object to copy.
+     */
+    KForm(const KForm& other) = default;
+
     /**
      * Assignment.
      * @param other the object to copy.
@@ -101,6 +101,12 @@ template <typename TCalculus, Order order_in, Duality duality_in, Order order_ou
      */
     LinearOperator(ConstAlias<Calculus> calculus, const Container& container);
 
+    /**
+     * Copy constructor.
+     * @param other the object to copy.
+     */
+    LinearOperator(const LinearOperator& other) = default;
+
     /**
      * Assignment.
      * @param other the object to copy.
@@ -0,0 +1,322 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLaplaceSolver.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MatrixFreeLaplaceSolver.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLaplaceSolver_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLaplaceSolver.h
+#else // defined(MatrixFreeLaplaceSolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLaplaceSolver_RECURSES
+
+#if !defined MatrixFreeLaplaceSolver_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLaplaceSolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/MatrixFreeLaplacian.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLaplaceSolver
+  /**
+   * Description of template class 'MatrixFreeLaplaceSolver' <p>
+   * \brief Aim:
+   * Solves (a.Id + b.laplace<duality>()) x = y on the 0-forms of a
+   * volumetric discrete exterior calculus with a conjugate gradient,
+   * preconditioned by a geometric multigrid, without assembling nor
+   * factorizing any sparse matrix.
+   *
+   * This is an alternative to DiscreteExteriorCalculusSolver for the
+   * large Poisson and heat problems, for which sparse direct solvers
+   * run out of memory in 3D: the memory used is linear in the number
+   * of 0-cells, and each iteration costs a few applications of
+   * MatrixFreeLaplacian, which are parallel if OpenMP is enabled.
+   *
+   * Since a.Id + b.L = W.S, with W diagonal and S symmetric (see
+   * MatrixFreeLaplacian), the conjugate gradient is run on
+   * S x = W^-1 y. The multigrid hierarchy is built by aggregating the
+   * grid nodes by blocks of 2^n (MatrixFreeLaplacian::coarsen) until
+   * at most 64 nodes remain, whose operator is factorized by a dense
+   * Cholesky decomposition. The preconditioner is one V-cycle with two
+   * damped Jacobi sweeps before and after each coarse correction,
+   * which keeps it symmetric.
+   *
+   * The hierarchy is built once by compute() for all the solves. As
+   * DiscreteExteriorCalculusSolver, solves can write in an existing
+   * 0-form, start from an initial guess (the previous time step of a
+   * heat flow converges in a few iterations) and process blocks of
+   * 0-forms stored as the columns of a dense matrix.
+   *
+   * S is singular when a == 0 and no 1-cell leaves the calculus (for
+   * example for the primal laplacian): the input must then have a zero
+   * mean for the hodge weights, and the solution is defined up to a
+   * constant.
+   *
+   * @code
+   * typedef MatrixFreeLaplaceSolver<Calculus, DUAL> Solver;
+   * const Solver::Operator laplacian( calculus );
+   * Solver solver;
+   * solver.compute( laplacian );
+   * const Calculus::DualForm0 solution = solver.solve( input );
+   * @endcode
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus, with
+   * dimensionEmbedded == dimensionAmbient.
+   * @tparam duality duality of the 0-forms.
+   *
+   * @see testMatrixFreeLaplacian.cpp
+   */
+  template <typename TCalculus, Duality duality>
+  class MatrixFreeLaplaceSolver
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef MatrixFreeLaplacian<Calculus, duality> Operator;
+    typedef typename Operator::Stencil Stencil;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
+    typedef typename Operator::Form SolutionKForm;
+    typedef typename Operator::Form InputKForm;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * The relative tolerance defaults to 1e-8 and the maximal number of
+     * iterations to 1000, with the multigrid preconditioner.
+     */
+    MatrixFreeLaplaceSolver();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Sets the problem operator and builds the multigrid hierarchy.
+     * @param linear_operator the operator, which must outlive the solver.
+     * @return *this.
+     */
+    MatrixFreeLaplaceSolver& compute(ConstAlias<Operator> linear_operator);
+
+    /**
+     * Solves the problem.
+     * @param input_kform input 0-form.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform) const;
+
+    /**
+     * Solves the problem in place.
+     * @param input_kform input 0-form.
+     * @param[out] solution_kform problem solution, its storage is reused.
+     */
+    void solve(const InputKForm& input_kform, SolutionKForm& solution_kform) const;
+
+    /**
+     * Solves the problem starting from an initial guess, typically the
+     * solution of the previous time step.
+     * @param input_kform input 0-form.
+     * @param[in,out] solution_kform initial guess, replaced by the problem solution.
+     */
+    void solveWithGuess(const InputKForm& input_kform, SolutionKForm& solution_kform) const;
+
+    /**
+     * Solves the problem for a block of inputs.
+     * @param inputs input 0-forms containers, one per column.
+     * @param[out] solutions problem solutions, one per column, its storage is reused.
+     */
+    void solve(const DenseMatrix& inputs, DenseMatrix& solutions) const;
+
+    /**
+     * Solves the problem for a block of inputs, starting from initial guesses.
+     * iterations() and error() then report the worst column.
+     * @param inputs input 0-forms containers, one per column.
+     * @param[in,out] solutions initial guesses, replaced by the problem solutions.
+     */
+    void solveWithGuess(const DenseMatrix& inputs, DenseMatrix& solutions) const;
+
+    /**
+     * @param tolerance the relative residual norm ||S x - W^-1 y|| / ||W^-1 y|| to reach.
+     */
+    void setTolerance(const Scalar tolerance);
+
+    /**
+     * @param max_iterations the maximal number of conjugate gradient iterations.
+     */
+    void setMaxIterations(const Index max_iterations);
+
+    /**
+     * Enables or disables the multigrid preconditioner (disabled, the
+     * conjugate gradient is not preconditioned). Takes effect at the
+     * next call to compute.
+     * @param multigrid true to precondition with a V-cycle.
+     */
+    void setMultigrid(const bool multigrid);
+
+    /**
+     * @return the number of iterations of the last solve.
+     */
+    Index iterations() const;
+
+    /**
+     * @return the relative residual norm reached by the last solve.
+     */
+    Scalar error() const;
+
+    /**
+     * @return the number of levels of the multigrid hierarchy (0 if
+     * the preconditioner is disabled).
+     */
+    Index nbLevels() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if an operator is set and the last solve reached
+     * the tolerance, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The problem operator.
+    const Operator* myOperator;
+    /// Relative tolerance.
+    Scalar myTolerance;
+    /// Maximal number of iterations.
+    Index myMaxIterations;
+    /// Use the multigrid preconditioner.
+    bool myMultigrid;
+    /// Stencils of the levels coarser than the operator one.
+    std::vector<Stencil> myCoarseStencils;
+    /// For each level but the coarsest, the node of the next level of each node.
+    std::vector< std::vector<Index> > myParents;
+    /// Inverse of the operator of the coarsest level.
+    DenseMatrix myCoarsestInverse;
+    /// Number of iterations of the last solve.
+    mutable Index myIterations;
+    /// Relative residual of the last solve.
+    mutable Scalar myError;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param level a level of the hierarchy.
+     * @return the stencil of this level.
+     */
+    const Stencil& stencil(const Index level) const;
+
+    /**
+     * Runs the preconditioned conjugate gradient.
+     * @param input input container.
+     * @param[in,out] solution initial guess, replaced by the solution.
+     * @param[out] iterations number of iterations.
+     * @param[out] error relative residual norm reached.
+     */
+    void solveFromGuess(const DenseVector& input, DenseVector& solution, Index& iterations, Scalar& error) const;
+
+    /**
+     * Computes the inverse of the operator of the coarsest level.
+     * Vanishing pivots are skipped, so that the inverse is a symmetric
+     * pseudo-inverse when the operator is singular.
+     */
+    void factorizeCoarsest();
+
+    /**
+     * Applies the preconditioner.
+     * @param residual residual.
+     * @param[out] correction preconditioned residual.
+     */
+    void precondition(const DenseVector& residual, DenseVector& correction) const;
+
+    /**
+     * Approximately solves the problem of a level with a V-cycle started from 0.
+     * @param level a level of the hierarchy.
+     * @param rhs the right-hand side.
+     * @param[out] solution the approximate solution.
+     */
+    void vcycle(const Index level, const DenseVector& rhs, DenseVector& solution) const;
+
+    /**
+     * Applies one damped Jacobi sweep.
+     * @param stencil the operator.
+     * @param rhs the right-hand side.
+     * @param[in,out] solution the solution to improve.
+     * @param buffer a buffer.
+     */
+    static void jacobi(const Stencil& stencil, const DenseVector& rhs, DenseVector& solution, DenseVector& buffer);
+
+  }; // end of class MatrixFreeLaplaceSolver
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLaplaceSolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLaplaceSolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus, Duality duality>
+  std::ostream&
+  operator<<(std::ostream& out, const MatrixFreeLaplaceSolver<TCalculus, duality>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLaplaceSolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLaplaceSolver_h
+
+#undef MatrixFreeLaplaceSolver_RECURSES
+#endif // else defined(MatrixFreeLaplaceSolver_RECURSES)
@@ -0,0 +1,260 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLaplacian.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MatrixFreeLaplacian.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLaplacian_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLaplacian.h
+#else // defined(MatrixFreeLaplacian_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLaplacian_RECURSES
+
+#if !defined MatrixFreeLaplacian_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLaplacian_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLaplacian
+  /**
+   * Description of template class 'MatrixFreeLaplacian' <p>
+   * \brief Aim:
+   * Applies the operator a.Id + b.laplace<duality>() of a volumetric
+   * discrete exterior calculus to 0-forms without assembling any
+   * sparse matrix.
+   *
+   * The 0-cells of a volumetric calculus lie on a regular grid (one
+   * node every two Khalimsky coordinates) and two 0-cells are linked
+   * by a 1-cell iff they are neighbors along an axis. The laplacian
+   * of the calculus is then L = W.K, where W is the diagonal of the
+   * hodge operator of the n-forms (one weight per 0-cell) and K is the
+   * symmetric weighted graph laplacian whose edge weights are the
+   * diagonal of the hodge operator of the 1-forms. Edges whose other
+   * 0-cell does not belong to the calculus (dual border) only
+   * contribute to the diagonal of K (Dirichlet condition).
+   *
+   * The operator stores these weights in a Stencil: a dense table
+   * from the grid to the 0-cell indexes, one weight per 0-cell and
+   * per axis, and the diagonal of K. a.Id + b.L = W.(a.W^-1 + b.K) is
+   * thus applied in O(n) time and memory, neighbors being found
+   * through the grid strides, and each row being computed
+   * independently (in parallel if OpenMP is enabled). The symmetric
+   * factor a.W^-1 + b.K is also exposed, since it is the one solved
+   * by MatrixFreeLaplaceSolver.
+   *
+   * @code
+   * typedef MatrixFreeLaplacian<Calculus, DUAL> Laplacian;
+   * const Laplacian laplacian( calculus );
+   * const Calculus::DualForm0 output = laplacian * input; // == calculus.laplace<DUAL>() * input
+   * @endcode
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus, with
+   * dimensionEmbedded == dimensionAmbient.
+   * @tparam duality duality of the 0-forms.
+   *
+   * @see testMatrixFreeLaplacian.cpp
+   */
+  template <typename TCalculus, Duality duality>
+  class MatrixFreeLaplacian
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef TCalculus Calculus;
+    BOOST_STATIC_ASSERT(( Calculus::dimensionEmbedded == Calculus::dimensionAmbient ));
+
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Point Point;
+    typedef KForm<Calculus, 0, duality> Form;
+
+    /// Dimension of the grid of 0-cells.
+    static const Dimension dimension = Calculus::dimensionAmbient;
+
+    /**
+     * A symmetric operator S on a subset of a regular grid:
+     * (S.x)_a = diagonal_a x_a - sum of weights(a,b) x_b over the grid
+     * neighbors b of a, where weights(a,b) is stored in a, at position
+     * dimension*a+k, if b is the neighbor of a along axis k in the
+     * positive direction.
+     */
+    struct Stencil
+    {
+      /// Number of grid nodes along each axis.
+      boost::array<Index, dimension> extents;
+      /// Strides of the grid along each axis.
+      boost::array<Index, dimension> strides;
+      /// Node index of each grid position, -1 if the position is empty.
+      std::vector<Index> nodes;
+      /// Grid position of each node.
+      std::vector<Index> positions;
+      /// Weights of the edges towards the positive direction of each axis.
+      std::vector<Scalar> weights;
+      /// Diagonal of the operator.
+      std::vector<Scalar> diagonal;
+
+      /// @return the number of nodes.
+      Index size() const { return static_cast<Index>( positions.size() ); }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Reads the weights of the operator from the calculus,
+     * which must not change afterwards.
+     * @param calculus a volumetric discrete exterior calculus.
+     * @param identity_coefficient coefficient a of the identity.
+     * @param laplace_coefficient coefficient b of the laplacian.
+     */
+    MatrixFreeLaplacian( ConstAlias<Calculus> calculus,
+                         const Scalar identity_coefficient = 0,
+                         const Scalar laplace_coefficient = 1 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Applies the operator.
+     * @param input a 0-form of the calculus.
+     * @return (a.Id + b.L) input.
+     */
+    Form operator*( const Form& input ) const;
+
+    /**
+     * Applies the operator to a container.
+     * @param input input container, of size size().
+     * @param output output container, resized if needed.
+     */
+    void apply( const DenseVector& input, DenseVector& output ) const;
+
+    /**
+     * Applies the symmetric factor a.W^-1 + b.K of the operator.
+     * @param input input container, of size size().
+     * @param output output container, resized if needed.
+     */
+    void applySymmetric( const DenseVector& input, DenseVector& output ) const;
+
+    /**
+     * @return the stencil of the symmetric factor a.W^-1 + b.K.
+     */
+    const Stencil& stencil() const;
+
+    /**
+     * @return the diagonal W of the hodge operator of the n-forms.
+     */
+    const DenseVector& hodgeWeights() const;
+
+    /**
+     * @return the number of 0-cells.
+     */
+    Index size() const;
+
+    /**
+     * Applies a stencil.
+     * @param stencil any stencil.
+     * @param input input container, of size stencil.size().
+     * @param output output container, resized if needed.
+     */
+    static void applyStencil( const Stencil& stencil, const DenseVector& input, DenseVector& output );
+
+    /**
+     * Aggregates the nodes of a stencil by blocks of 2^dimension grid
+     * positions. The coarse stencil is the Galerkin operator
+     * P^t.S.P, where P copies the value of each coarse node to its
+     * fine nodes.
+     * @param fine the stencil to coarsen.
+     * @param[out] coarse the coarse stencil.
+     * @param[out] parents the coarse node of each fine node.
+     */
+    static void coarsen( const Stencil& fine, Stencil& coarse, std::vector<Index>& parents );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream& out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Stencil of a.W^-1 + b.K.
+    Stencil myStencil;
+    /// Diagonal W of the hodge operator of the n-forms.
+    DenseVector myHodgeWeights;
+
+  }; // end of class MatrixFreeLaplacian
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLaplacian'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLaplacian' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus, Duality duality>
+  std::ostream&
+  operator<<( std::ostream& out, const MatrixFreeLaplacian<TCalculus, duality>& object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLaplacian.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLaplacian_h
+
+#undef MatrixFreeLaplacian_RECURSES
+#endif // else defined(MatrixFreeLaplacian_RECURSES)
@@ -90,6 +90,12 @@ template <typename TCalculus, Duality duality>
      */
     VectorField(ConstAlias<Calculus> calculus, const Container& container);
 
+    /**
+     * Copy constructor.
+     * @param other the object to copy.
+     */
+    VectorField(const VectorField& other) = default;
+
     /**
      * Assignment.
      * @param other the object to copy.
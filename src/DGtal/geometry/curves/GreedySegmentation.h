@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
 #include "DGtal/geometry/curves/CForwardSegmentComputer.h"
@@ -142,6 +144,18 @@ namespace DGtal
    * @endcode  
    * Note that the default mode will be used for any unknown modes.  
    *
+   * For long curves, all the segments may be computed at once with
+   * the segments() method. If the range is given by random-access
+   * iterators (not circulators), the range is cut into chunks
+   * processed independently (in parallel if DGtal is built with
+   * OpenMP), then the chunks are stitched so that the result is
+   * exactly the sequence of segments given by the iteration:
+   * @code 
+  std::vector<SegmentComputer> segments;
+  theSegmentation.segments(segments);
+   * @endcode  
+   * Many curves may also be segmented at once with batchSegments().
+   *
    * @see testSegmentation.cpp 
    */
 
@@ -430,6 +444,44 @@ namespace DGtal
      */
     typename GreedySegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the segments of the segmentation at once, as the
+     * iteration from begin() to end() does. 
+     *
+     * If the underlying range is given by random-access iterators
+     * (not circulators), the subrange to process is cut into chunks.
+     * The segmentation of each chunk is computed from its first
+     * element, independently of the others (in parallel if DGtal is
+     * built with OpenMP). Then the true segmentation is continued
+     * from the end of one chunk until it meets a segment of the next
+     * chunk: since a segment only depends on its first element, both
+     * coincide afterwards. Otherwise, the segments are computed
+     * sequentially.
+     *
+     * @param[out] result the segments, in the order of the iteration
+     * (cleared first).
+     * @param nbChunks the number of chunks, or 0 for an automatic
+     * choice depending on the number of threads and on the length of
+     * the subrange.
+     */
+    void segments( std::vector<SegmentComputer> & result,
+                   unsigned int nbChunks = 0 ) const;
+
+    /**
+     * Batch service: computes the greedy segmentations of several
+     * ranges, in parallel if DGtal is built with OpenMP. The result
+     * for each range is the sequence of segments of the iteration.
+     *
+     * @param ranges the pairs of begin and end iterators of the ranges.
+     * @param aSegmentComputer  an online segment recognition algorithm.
+     * @param[out] results the segments of each range.
+     * @param aMode the processing mode of each segmentation (see setMode).
+     */
+    static void batchSegments( const std::vector< std::pair<ConstIterator,ConstIterator> > & ranges,
+                               const SegmentComputer& aSegmentComputer,
+                               std::vector< std::vector<SegmentComputer> > & results,
+                               const std::string& aMode = "Truncate" );
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -499,6 +551,22 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes all the segments by iteration (generic case).
+     * @param[out] result the segments.
+     */
+    template <typename TType, typename TCategory>
+    void segments( std::vector<SegmentComputer> & result, unsigned int,
+                   TType, TCategory ) const;
+
+    /**
+     * Computes all the segments by chunks (random-access iterators).
+     * @param[out] result the segments.
+     * @param nbChunks the number of chunks (0 for automatic).
+     */
+    void segments( std::vector<SegmentComputer> & result, unsigned int nbChunks,
+                   IteratorType, RandomAccessCategory ) const;
+
   }; // end of class GreedySegmentation
 
 
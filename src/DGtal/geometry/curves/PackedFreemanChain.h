@@ -0,0 +1,450 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes a digital 4-connected contour like
+   * FreemanChain, but stores each code on 2 bits (32 codes per 64-bit
+   * word) instead of one character, together with the coordinates of
+   * one point every \ref CheckpointStep codes.
+   *
+   * The i-th point of the contour is thus obtained in constant time
+   * from the closest checkpoint before it, by counting the codes of a
+   * few words with bit operations. The ConstIterator on points is a
+   * random-access iterator, so that any algorithm working on a range
+   * of points (segment computers, segmentations, GridCurve or
+   * FreemanChain initialization from a range of points) runs directly
+   * on a packed chain.
+   *
+   * Besides the text format of FreemanChain (.fc files), packed chains
+   * may be written and read in a binary format, which stores the packed
+   * words as is (see \ref writeBinary).
+   *
+   * @code
+   typedef PackedFreemanChain<int> Contour;
+   typedef ArithmeticalDSSComputer<Contour::ConstIterator,int,4> DSSComputer;
+
+   std::fstream fst( "contour.fc", std::ios::in );
+   Contour c( fst );
+   Contour::Point p = c.getPoint( 1000 );
+   GreedySegmentation<DSSComputer> s( c.begin(), c.end(), DSSComputer() );
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points.
+   *
+   * @see FreemanChain testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef FreemanChain<Integer> Chain;
+    typedef unsigned int Size;
+    typedef unsigned int Index;
+    typedef DGtal::uint64_t Word;
+
+    /// The number of codes per word.
+    static const Size CodesPerWord = 32;
+    /// The number of codes between two stored points (a multiple of CodesPerWord).
+    static const Size CheckpointStep = 256;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // class PackedFreemanChain::ConstIterator
+    /**
+     * Random-access iterator on the points of the chain, storing the
+     * current point. Incrementing or decrementing decodes one code;
+     * any other move costs a call to getPoint().
+     */
+    class ConstIterator : public
+      std::iterator<std::random_access_iterator_tag, Point, std::ptrdiff_t, const Point*, const Point&>
+    {
+    public:
+      typedef std::ptrdiff_t Difference;
+
+    private:
+      /// The chain visited by the iterator.
+      const PackedFreemanChain* myChain;
+      /// The current position, between 0 and size()+1.
+      Index myPos;
+      /// The current point (invalid after the last point).
+      Point myXY;
+
+    public:
+      /**
+       * Default constructor. The object is not valid.
+       */
+      ConstIterator()
+        : myChain( 0 ), myPos( 0 )
+      { }
+
+      /**
+       * Constructor.
+       * @param aChain a packed chain.
+       * @param n a position between 0 and aChain.size()+1.
+       */
+      ConstIterator( ConstAlias<PackedFreemanChain> aChain, Index n = 0 );
+
+      /// @return the current point.
+      const Point& operator*() const
+      {
+        return myXY;
+      }
+
+      /// @return a pointer to the current point.
+      const Point* operator->() const
+      {
+        return &myXY;
+      }
+
+      /// @return the point at \a n positions from the current one.
+      Point operator[]( Difference n ) const
+      {
+        return myChain->getPoint( (Index) ( myPos + n ) );
+      }
+
+      /// @return the current position.
+      Index position() const
+      {
+        return myPos;
+      }
+
+      /// @return the current Freeman code (the move to the next point).
+      char getCode() const
+      {
+        ASSERT( myChain != 0 );
+        return myChain->code( myPos );
+      }
+
+      /// Pre-increment.
+      ConstIterator& operator++();
+      /// Pre-decrement.
+      ConstIterator& operator--();
+
+      /// Post-increment.
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// Post-decrement.
+      ConstIterator operator--( int )
+      {
+        ConstIterator tmp( *this );
+        --( *this );
+        return tmp;
+      }
+
+      /// Moves of \a n positions.
+      ConstIterator& operator+=( Difference n );
+
+      /// Moves of -\a n positions.
+      ConstIterator& operator-=( Difference n )
+      {
+        return ( *this ) += -n;
+      }
+
+      ConstIterator operator+( Difference n ) const
+      {
+        ConstIterator tmp( *this );
+        return tmp += n;
+      }
+
+      ConstIterator operator-( Difference n ) const
+      {
+        ConstIterator tmp( *this );
+        return tmp += -n;
+      }
+
+      Difference operator-( const ConstIterator & other ) const
+      {
+        ASSERT( myChain == other.myChain );
+        return (Difference) myPos - (Difference) other.myPos;
+      }
+
+      bool operator==( const ConstIterator & other ) const
+      {
+        ASSERT( myChain == other.myChain );
+        return myPos == other.myPos;
+      }
+
+      bool operator!=( const ConstIterator & other ) const
+      {
+        ASSERT( myChain == other.myChain );
+        return myPos != other.myPos;
+      }
+
+      bool operator<( const ConstIterator & other ) const
+      {
+        ASSERT( myChain == other.myChain );
+        return myPos < other.myPos;
+      }
+
+      bool operator>( const ConstIterator & other ) const
+      {
+        return other < *this;
+      }
+
+      bool operator<=( const ConstIterator & other ) const
+      {
+        return !( other < *this );
+      }
+
+      bool operator>=( const ConstIterator & other ) const
+      {
+        return !( *this < other );
+      }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param s a string of codes '0', '1', '2', '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s = "", Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param aChain any Freeman chain.
+     */
+    PackedFreemanChain( const Chain & aChain );
+
+    /**
+     * Constructor from a stream in the text format of FreemanChain
+     * (see \ref read). The chain is empty if the stream holds no chain.
+     * @param in any input stream.
+     */
+    PackedFreemanChain( std::istream & in );
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain();
+
+    /**
+     * Removes all the codes and sets the first point.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void clear( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Appends a code at the end of the chain.
+     * @param aCode a code among '0', '1', '2', '3'.
+     */
+    void extend( char aCode );
+
+    /// @return the number of codes (the number of points minus one).
+    Size size() const;
+
+    /**
+     * @param pos a position in [0, size()).
+     * @return the code at position \a pos (a char among '0', '1', '2', '3').
+     */
+    char code( Index pos ) const;
+
+    /// @return the first point.
+    const Point & firstPoint() const;
+
+    /// @return the last point.
+    const Point & lastPoint() const;
+
+    /**
+     * Computes the point at position \a pos in constant time.
+     * @param pos a position in [0, size()].
+     * @return the point at position \a pos.
+     */
+    Point getPoint( Index pos ) const;
+
+    /// @return an iterator on the first point.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last point (at position size()+1).
+    ConstIterator end() const;
+
+    /**
+     * @return the equivalent Freeman chain.
+     */
+    Chain freemanChain() const;
+
+    /**
+     * @return the number of bytes used by the codes and the checkpoints.
+     */
+    std::size_t memorySize() const;
+
+    // ----------------------- Input / output ---------------------------------
+  public:
+
+    /**
+     * Reads a chain in the text format of FreemanChain: the first line
+     * that is not empty nor a comment (beginning with '#') gives the
+     * coordinates of the first point and the codes. The codes are
+     * packed while reading. If there is no such line, \a c is left
+     * unchanged, and if its coordinates cannot be read, \a c is
+     * cleared.
+     *
+     * @param in any input stream.
+     * @param c (returns) the chain.
+     */
+    static void read( std::istream & in, PackedFreemanChain & c );
+
+    /**
+     * Writes the chain in the binary format: the 8 characters
+     * "DGtalPFC", the coordinates of the first point (two 64-bit
+     * integers), the number of codes (a 64-bit integer) and the
+     * words of codes (64-bit integers). All integers are little
+     * endian. The checkpoints are not written.
+     *
+     * @param out any output stream (opened in binary mode).
+     * @return 'true' if the writing succeeded.
+     */
+    bool writeBinary( std::ostream & out ) const;
+
+    /**
+     * Reads a chain written with \ref writeBinary.
+     *
+     * @param in any input stream (opened in binary mode).
+     * @param c (returns) the chain.
+     * @return 'true' if the reading succeeded, 'false' if the stream
+     * is not in the binary format, is truncated, announces more codes
+     * than the remaining bytes of a seekable stream, or has non-zero
+     * bits after the last code (and then \a c is empty).
+     */
+    static bool readBinary( std::istream & in, PackedFreemanChain & c );
+
+    /**
+     * Moves the point \a aPoint according to the code \a aCode.
+     * @param aPoint (modified) any point.
+     * @param aCode a code among 0, 1, 2, 3 (not a char).
+     */
+    static void move( Point & aPoint, unsigned int aCode );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream, in the text
+     * format of FreemanChain.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The codes, 2 bits each, the code i at bits 2(i%32) of word i/32.
+    std::vector<Word> myWords;
+    /// The points at positions 0, CheckpointStep, 2.CheckpointStep, etc.
+    std::vector<Point> myCheckpoints;
+    /// The number of codes.
+    Size mySize;
+    /// The last point.
+    Point myLastPoint;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Adds to \a p the displacement of the first \a n codes of the word \a w.
+     * @param p (modified) any point.
+     * @param w a word of codes.
+     * @param n a number of codes in [0, CodesPerWord].
+     */
+    static void addDisplacement( Point & p, Word w, Size n );
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
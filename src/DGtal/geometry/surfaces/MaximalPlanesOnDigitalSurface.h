@@ -0,0 +1,339 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MaximalPlanesOnDigitalSurface.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MaximalPlanesOnDigitalSurface.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MaximalPlanesOnDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in MaximalPlanesOnDigitalSurface.h
+#else // defined(MaximalPlanesOnDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MaximalPlanesOnDigitalSurface_RECURSES
+
+#if !defined MaximalPlanesOnDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define MaximalPlanesOnDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MaximalPlanesOnDigitalSurface
+  /**
+   * Description of template class 'MaximalPlanesOnDigitalSurface' <p>
+   * \brief Aim: grows a maximal digital plane around every surfel of
+   * a digital surface, in batch and in parallel.
+   *
+   * The point of a surfel is its inner voxel. The plane around a
+   * seed surfel is grown by breadth-first layers on the surface (as
+   * in \ref tutoPolyhedralisation): the whole layer at distance r is
+   * added with the range extend() of the plane computer, and growth
+   * stops at the first layer that does not fit. The radius of the
+   * seed is then the distance of its last accepted layer. For each
+   * surfel, the radius, the number of surfels within the plane, its
+   * normal and its axis width (thickness) are stored in flat arrays
+   * indexed by dense surfel ids.
+   *
+   * Compared to one BreadthFirstVisitor and one plane computer per
+   * surfel, the engine:
+   *
+   * - indexes the surface once: surfels are numbered in
+   *   breadth-first order and adjacencies are stored as flat
+   *   neighbor lists, so that traversals only use vectors (epoch
+   *   marks, layers of points) reused from one seed to the next;
+   *
+   * - reuses the recognition between neighboring seeds: if the seed
+   *   s has radius R, the ball of radius R-1 around any neighbor t of
+   *   s is contained in the ball of radius R around s, hence in a
+   *   digital plane. This ball is thus given to the plane computer of
+   *   t in a single extend() and only the next layers are tested one
+   *   by one. Radii do not depend on this shortcut;
+   *
+   * - processes blocks of consecutive seeds in parallel, each thread
+   *   having its own copy of the plane computer, if DGtal has been
+   *   built with OpenMP support (WITH_OPENMP flag set to "true").
+   *
+   * @code
+   * typedef ChordGenericNaivePlaneComputer<Z3, Z3::Point, DGtal::int64_t> PlaneComputer;
+   * PlaneComputer prototype;
+   * prototype.init( 2, 1 ); // axis width 2/1
+   * MaximalPlanesOnDigitalSurface<MyDigitalSurface, PlaneComputer> planes( digSurf );
+   * planes.init( prototype );
+   * for ( ConstIterator it = digSurf.begin(), itE = digSurf.end(); it != itE; ++it )
+   *   std::cout << planes.normal( planes.index( *it ) ) << std::endl;
+   * @endcode
+   *
+   * @tparam TDigitalSurface any type of DigitalSurface in 3D.
+   *
+   * @tparam TPlaneComputer any model of
+   * concepts::CAdditivePrimitiveComputer accepting the points of the
+   * space of the surface, whose primitive is a ParallelStrip
+   * (e.g. COBAGenericNaivePlaneComputer,
+   * ChordGenericNaivePlaneComputer). It must be copiable: every
+   * recognition starts from a copy of a given initialized prototype.
+   *
+   * @see testMaximalPlanesOnDigitalSurface.cpp
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  class MaximalPlanesOnDigitalSurface
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CAdditivePrimitiveComputer< TPlaneComputer > ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef MaximalPlanesOnDigitalSurface<TDigitalSurface, TPlaneComputer> Self;
+    typedef TDigitalSurface DigitalSurface;
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename DigitalSurface::KSpace KSpace;
+    typedef typename DigitalSurface::Surfel Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename PlaneComputer::Primitive Primitive;
+    typedef typename Primitive::RealVector RealVector;
+    typedef typename Primitive::Scalar Scalar;
+    /// Dense id of a surfel.
+    typedef std::size_t Index;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+
+    /**
+     * Constructor.
+     * @param surface the digital surface (aliased).
+     */
+    MaximalPlanesOnDigitalSurface( ConstAlias<DigitalSurface> surface );
+
+    /**
+     * Destructor.
+     */
+    ~MaximalPlanesOnDigitalSurface();
+
+    /**
+     * Grows the maximal plane around every surfel of the surface.
+     *
+     * @param prototype an initialized plane computer (e.g. with its
+     * axis width), copied at the beginning of every recognition.
+     *
+     * @param maxRadius the growth around a seed also stops at this
+     * distance (default: no limit).
+     *
+     * @param reuse when 'true' (default), the known part of the plane
+     * of the previous neighboring seed is added at once (see the
+     * class description). When 'false', every layer is tested.
+     */
+    void init( const PlaneComputer & prototype,
+               unsigned int maxRadius = (unsigned int) -1,
+               bool reuse = true );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of surfels.
+    Index size() const;
+
+    /**
+     * @param s any surfel.
+     * @return the id of @a s, or size() if @a s is not on the surface.
+     */
+    Index index( const Surfel & s ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the surfel of id @a i.
+     */
+    const Surfel & surfel( Index i ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the radius of the maximal plane grown around surfel @a i.
+     */
+    unsigned int radius( Index i ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the number of surfels within the maximal plane grown
+     * around surfel @a i.
+     */
+    Index nbSurfels( Index i ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the unit normal of the maximal plane grown around
+     * surfel @a i.
+     */
+    const RealVector & normal( Index i ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the axis width of the maximal plane grown around surfel
+     * @a i.
+     */
+    Scalar width( Index i ) const;
+
+    /// @return the radii of the planes, by surfel id.
+    const std::vector<unsigned int> & radii() const;
+
+    /// @return the normals of the planes, by surfel id.
+    const std::vector<RealVector> & normals() const;
+
+    /// @return the axis widths of the planes, by surfel id.
+    const std::vector<Scalar> & widths() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Buffers of one traversal, reused from one seed to the next.
+    struct Workspace
+    {
+      std::vector<unsigned int> marks; ///< visit epoch of each surfel
+      unsigned int epoch;              ///< current epoch
+      std::vector<Index> layer;        ///< current layer of surfels
+      std::vector<Index> next;         ///< next layer of surfels
+      std::vector<Point> points;       ///< points not yet given to the computer
+    };
+
+    /// The digital surface.
+    CountedConstPtrOrConstPtr<DigitalSurface> mySurface;
+    /// Surfels, by id (breadth-first order).
+    std::vector<Surfel> mySurfels;
+    /// Inner voxel of each surfel, by id.
+    std::vector<Point> myPoints;
+    /// Map surfel -> id.
+    std::unordered_map<Surfel, Index> myIndices;
+    /// Neighbors of surfel i are myNeighbors[ myNeighborOffsets[ i ] .. myNeighborOffsets[ i + 1 ] ).
+    std::vector<Index> myNeighborOffsets;
+    /// Flat neighbor lists.
+    std::vector<Index> myNeighbors;
+    /// Radius, by id.
+    std::vector<unsigned int> myRadii;
+    /// Number of surfels within the plane, by id.
+    std::vector<Index> myNbSurfels;
+    /// Normal, by id.
+    std::vector<RealVector> myNormals;
+    /// Axis width, by id.
+    std::vector<Scalar> myWidths;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MaximalPlanesOnDigitalSurface();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MaximalPlanesOnDigitalSurface ( const MaximalPlanesOnDigitalSurface & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MaximalPlanesOnDigitalSurface & operator= ( const MaximalPlanesOnDigitalSurface & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Numbers surfels in breadth-first order and builds neighbor lists.
+    void buildIndex();
+
+    /**
+     * Grows the maximal plane around surfel @a seed.
+     * @param seed the id of the seed.
+     * @param computer (modified) the plane computer, reset to @a prototype.
+     * @param prototype the initialized plane computer.
+     * @param known every layer up to this one is known to fit.
+     * @param maxRadius the maximal radius.
+     * @param ws (modified) the traversal buffers.
+     */
+    void grow( Index seed, PlaneComputer & computer, const PlaneComputer & prototype,
+               unsigned int known, unsigned int maxRadius, Workspace & ws );
+
+    /// @return 'true' iff surfels @a i and @a j are adjacent.
+    bool areNeighbors( Index i, Index j ) const;
+
+  }; // end of class MaximalPlanesOnDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MaximalPlanesOnDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MaximalPlanesOnDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MaximalPlanesOnDigitalSurface<TDigitalSurface, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/MaximalPlanesOnDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MaximalPlanesOnDigitalSurface_h
+
+#undef MaximalPlanesOnDigitalSurface_RECURSES
+#endif // else defined(MaximalPlanesOnDigitalSurface_RECURSES)
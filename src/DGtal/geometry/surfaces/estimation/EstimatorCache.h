@@ -66,7 +66,8 @@ namespace DGtal
    *
    * This class is also a model of concepts::CSurfelLocalEstimator
    *
-   * @see testEstimatorCache.cpp
+   * @see testEstimatorCache.cpp, FlatEstimatorCache for a cache stored
+   * in contiguous arrays, filled with the range eval of the estimator.
 
    * @tparam TEstimator any model of CSurfelLocalEstimator
    * @tparam TContainer the associative container to use (default type: std::map<Surfel,Quantity>)
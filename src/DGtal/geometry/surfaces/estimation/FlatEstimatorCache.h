@@ -0,0 +1,462 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatEstimatorCache.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FlatEstimatorCache.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatEstimatorCache_RECURSES)
+#error Recursive header files inclusion detected in FlatEstimatorCache.h
+#else // defined(FlatEstimatorCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatEstimatorCache_RECURSES
+
+#if !defined FlatEstimatorCache_h
+/** Prevents repeated inclusion of headers. */
+#define FlatEstimatorCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TDigitalSurfaceContainer, typename TMetric,
+            typename TFunctorOnSurfel, typename TConvolutionFunctor>
+  class LocalEstimatorFromSurfelFunctorAdapter;
+
+  namespace detail
+  {
+    /**
+     * Encodes and decodes values of type T on a fixed number of bytes
+     * (\a size), in little-endian order, for
+     * FlatEstimatorCache::writeBinary and readBinary. It is defined
+     * for arithmetic types, points and vectors, and Khalimsky
+     * (pre-)cells, and should be specialized for other surfel or
+     * quantity types: there is no raw byte fallback.
+     */
+    template <typename T, typename Enable = void>
+    struct FlatEstimatorCacheIO;
+
+    template <typename T>
+    struct FlatEstimatorCacheIO< T, typename std::enable_if< std::is_arithmetic<T>::value
+                                                             && ! std::is_same<T, bool>::value >::type >
+    {
+      static const std::size_t size = sizeof( T );
+      static unsigned char* write( unsigned char* out, const T & v );
+      static const unsigned char* read( const unsigned char* in, T & v );
+    };
+
+    template <>
+    struct FlatEstimatorCacheIO< bool >
+    {
+      static const std::size_t size = 1;
+      static unsigned char* write( unsigned char* out, const bool & v );
+      static const unsigned char* read( const unsigned char* in, bool & v );
+    };
+
+    template <DGtal::Dimension dim, typename TComponent, typename TContainer>
+    struct FlatEstimatorCacheIO< PointVector<dim, TComponent, TContainer> >
+    {
+      typedef FlatEstimatorCacheIO<TComponent> ComponentIO;
+      static const std::size_t size = dim * ComponentIO::size;
+      static unsigned char* write( unsigned char* out, const PointVector<dim, TComponent, TContainer> & v );
+      static const unsigned char* read( const unsigned char* in, PointVector<dim, TComponent, TContainer> & v );
+    };
+
+    template <DGtal::Dimension dim, typename TInteger>
+    struct FlatEstimatorCacheIO< KhalimskyPreCell<dim, TInteger> >
+    {
+      typedef FlatEstimatorCacheIO< typename KhalimskyPreCell<dim, TInteger>::Point > PointIO;
+      static const std::size_t size = PointIO::size;
+      static unsigned char* write( unsigned char* out, const KhalimskyPreCell<dim, TInteger> & c );
+      static const unsigned char* read( const unsigned char* in, KhalimskyPreCell<dim, TInteger> & c );
+    };
+
+    template <DGtal::Dimension dim, typename TInteger>
+    struct FlatEstimatorCacheIO< SignedKhalimskyPreCell<dim, TInteger> >
+    {
+      typedef FlatEstimatorCacheIO< typename SignedKhalimskyPreCell<dim, TInteger>::Point > PointIO;
+      static const std::size_t size = PointIO::size + 1;
+      static unsigned char* write( unsigned char* out, const SignedKhalimskyPreCell<dim, TInteger> & c );
+      static const unsigned char* read( const unsigned char* in, SignedKhalimskyPreCell<dim, TInteger> & c );
+    };
+
+    template <DGtal::Dimension dim, typename TInteger>
+    struct FlatEstimatorCacheIO< KhalimskyCell<dim, TInteger> >
+    {
+      typedef FlatEstimatorCacheIO< KhalimskyPreCell<dim, TInteger> > PreCellIO;
+      static const std::size_t size = PreCellIO::size;
+      static unsigned char* write( unsigned char* out, const KhalimskyCell<dim, TInteger> & c );
+      static const unsigned char* read( const unsigned char* in, KhalimskyCell<dim, TInteger> & c );
+    };
+
+    template <DGtal::Dimension dim, typename TInteger>
+    struct FlatEstimatorCacheIO< SignedKhalimskyCell<dim, TInteger> >
+    {
+      typedef FlatEstimatorCacheIO< SignedKhalimskyPreCell<dim, TInteger> > PreCellIO;
+      static const std::size_t size = PreCellIO::size;
+      static unsigned char* write( unsigned char* out, const SignedKhalimskyCell<dim, TInteger> & c );
+      static const unsigned char* read( const unsigned char* in, SignedKhalimskyCell<dim, TInteger> & c );
+    };
+
+    /**
+     * Tells if an estimator has a parallel range evaluation
+     * evalParallel(itb, ite, result) on vector iterators (value is
+     * true), as LocalEstimatorFromSurfelFunctorAdapter.
+     */
+    template <typename TEstimator>
+    struct FlatEstimatorCacheHasEvalParallel
+    {
+      typedef typename std::vector<typename TEstimator::Surfel>::const_iterator SurfelIterator;
+      typedef std::back_insert_iterator< std::vector<typename TEstimator::Quantity> > OutputIterator;
+      template <typename E>
+      static std::true_type test( decltype( std::declval<const E &>().evalParallel
+                                            ( std::declval<SurfelIterator>(),
+                                              std::declval<SurfelIterator>(),
+                                              std::declval<OutputIterator>() ) ) * );
+      template <typename E>
+      static std::false_type test( ... );
+      static const bool value = decltype( test<TEstimator>( 0 ) )::value;
+    };
+
+    /**
+     * Tells if the copies of an estimator share a mutable state, hence
+     * cannot evaluate chunks concurrently (value is true). It is the
+     * case of LocalEstimatorFromSurfelFunctorAdapter, whose copies
+     * share the functor.
+     */
+    template <typename TEstimator>
+    struct FlatEstimatorCacheSharedCopies : std::false_type {};
+
+    template <typename TDigitalSurfaceContainer, typename TMetric,
+              typename TFunctorOnSurfel, typename TConvolutionFunctor>
+    struct FlatEstimatorCacheSharedCopies
+    < LocalEstimatorFromSurfelFunctorAdapter<TDigitalSurfaceContainer, TMetric,
+                                             TFunctorOnSurfel, TConvolutionFunctor> >
+      : std::true_type {};
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatEstimatorCache
+  /**
+   * Description of template class 'FlatEstimatorCache' <p>
+   * \brief Aim: this class adapts any local surface estimator to cache the
+   * estimated values in contiguous arrays indexed by dense surfel ids.
+   *
+   * As EstimatorCache, it is useful when the same quantity is
+   * estimated several times, but it stores the surfels of the
+   * initialization range and their quantities in two vectors (the id
+   * of a surfel is its rank in the range) and retrieves the id of a
+   * surfel with an open addressing hash table of ids. Values are
+   * computed at init() with the range eval of the estimator, possibly
+   * on several chunks in parallel if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true").
+   *
+   * The cache can be written to and read from a binary stream, so
+   * that repeated analyses of the same surface skip the estimation.
+   *
+   * This class is a model of concepts::CSurfelLocalEstimator.
+   *
+   * @code
+   * FlatEstimatorCache<MyEstimator> cache( estimator );
+   * cache.init( h, surface.begin(), surface.end() );
+   * std::ofstream out( "cache.bin", std::ios::binary );
+   * cache.writeBinary( out );
+   * @endcode
+   *
+   * @tparam TEstimator any model of CSurfelLocalEstimator. Its Surfel
+   * type must have a std::hash specialization (e.g. Khalimsky cells).
+   * For binary input/output, its Surfel and Quantity types must have
+   * a detail::FlatEstimatorCacheIO specialization (arithmetic types,
+   * points and vectors, Khalimsky cells).
+   *
+   * @see EstimatorCache, testEstimatorCache.cpp
+   */
+  template <typename TEstimator>
+  class FlatEstimatorCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Estimator type
+    typedef TEstimator Estimator;
+    BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<TEstimator> ));
+
+    ///Surfel type
+    typedef typename Estimator::Surfel Surfel;
+
+    ///Quantity type
+    typedef typename Estimator::Quantity Quantity;
+
+    ///Dense id of a cached surfel
+    typedef std::size_t Index;
+
+    ///Self
+    typedef FlatEstimatorCache<Estimator> Self;
+
+    /**
+     * Default constructor.
+     */
+    FlatEstimatorCache();
+
+    /**
+     * Constructor from estimator instance.
+     * @param anEstimator the estimator whose values are cached (aliased).
+     */
+    FlatEstimatorCache( Alias<Estimator> anEstimator );
+
+    /**
+     * Destructor.
+     */
+    ~FlatEstimatorCache();
+
+    // ----------------------- CSurfelLocalEstimator Interface ----------------
+  public:
+
+    /**
+     * Estimator initialization. This method initializes the underlying
+     * estimator and caches all estimated quantities between @a itb
+     * and @a ite, calling the range eval of the estimator on @a
+     * nbChunks consecutive chunks of surfels.
+     *
+     * If nbChunks > 1 and the estimator has an evalParallel method
+     * (e.g. LocalEstimatorFromSurfelFunctorAdapter), the whole range
+     * is evaluated by evalParallel. Otherwise, each chunk is evaluated
+     * by its own copy of the (initialized) estimator, in parallel if
+     * OpenMP is available: copies of the estimator must then be
+     * independent, which is checked at compile time for the estimators
+     * known to share their state (see
+     * detail::FlatEstimatorCacheSharedCopies).
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     * @param[in] nbChunks the number of chunks (default 1: one range eval).
+     */
+    template <typename SurfelConstIterator>
+    void init( const double aH, SurfelConstIterator itb, SurfelConstIterator ite,
+               unsigned int nbChunks = 1 );
+
+    /**
+     * Cached evaluation of the estimator at iterator @a it
+     *
+     * @pre init() or readBinary() must have been called first and
+     * *it must be cached.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] it the iterator to the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator>
+    Quantity eval( const SurfelConstIterator it ) const;
+
+    /**
+     * Cached evaluation of the estimator at a surfel @a s
+     *
+     * @pre init() or readBinary() must have been called first and
+     * @a s must be cached.
+     *
+     * @param [in] s the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    Quantity eval( const Surfel s ) const;
+
+    /**
+     * Cached range evaluation of the estimator between @a itb
+     * and @a ite.
+     *
+     * @pre init() or readBinary() must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] itb the begin iterator to the surfel to estimate.
+     * @param [in] ite the end iterator to the surfel to estimate.
+     * @param [in] result an output iterator on the result.
+     * @return the output iterator after the last written quantity.
+     */
+    template <typename SurfelConstIterator, typename OutputIterator>
+    OutputIterator eval( SurfelConstIterator itb,
+                         SurfelConstIterator ite,
+                         OutputIterator result ) const;
+
+    /**
+     * @return the gridstep.
+     * @pre init() or readBinary() must have been called first.
+     */
+    double h() const;
+
+    // ----------------------- Index services ---------------------------------
+  public:
+
+    /// @return the number of cached elements.
+    Index size() const;
+
+    /**
+     * @param s any surfel.
+     * @return the id of @a s, or size() if @a s is not cached.
+     */
+    Index index( const Surfel & s ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the surfel of id @a i.
+     */
+    const Surfel & surfel( Index i ) const;
+
+    /**
+     * @param i any id (i < size()).
+     * @return the quantity of the surfel of id @a i.
+     */
+    const Quantity & quantity( Index i ) const;
+
+    /// @return the cached quantities, ordered by id.
+    const std::vector<Quantity> & quantities() const;
+
+    // ----------------------- Input/output -----------------------------------
+  public:
+
+    /**
+     * Writes the cache on a binary stream: a magic number, the
+     * encoded sizes of a surfel and of a quantity, the number of
+     * surfels, the gridstep, then the surfels and the quantities. All
+     * values are encoded element-wise in little-endian order (see
+     * detail::FlatEstimatorCacheIO), so that the stream can be read
+     * back on any architecture.
+     *
+     * @param out the output stream (opened in binary mode).
+     * @return 'true' if the stream is still good after writing.
+     */
+    bool writeBinary( std::ostream & out ) const;
+
+    /**
+     * Reads a cache written by writeBinary(). The cache is then
+     * initialized without calling the estimator.
+     *
+     * @param in the input stream (opened in binary mode).
+     * @return 'true' if the cache has been read, 'false' if the
+     * stream is not valid or truncated, or if its number of surfels
+     * exceeds the remaining bytes of a seekable stream (the cache is
+     * then cleared and not initialized).
+     */
+    bool readBinary( std::istream & in );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Alias of the estimator
+    Estimator *myEstimator;
+
+    ///Gridstep
+    double myH;
+
+    ///Init flag
+    bool myInit;
+
+    ///Cached surfels, by id
+    std::vector<Surfel> mySurfels;
+
+    ///Cached quantities, by id
+    std::vector<Quantity> myQuantities;
+
+    ///Open addressing table of ids (size() marks an empty slot)
+    std::vector<Index> myTable;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Builds the hash table of ids from mySurfels.
+    void buildTable();
+
+    /**
+     * Evaluates mySurfels with the evalParallel method of the estimator.
+     * @param nb the number of chunks (unused).
+     * @param[out] values the quantities, in the order of mySurfels.
+     */
+    void evalChunks( long nb, std::vector<Quantity> & values, std::true_type ) const;
+
+    /**
+     * Evaluates mySurfels by nb chunks, each with its own copy of the
+     * estimator.
+     * @param nb the number of chunks.
+     * @param[out] values the quantities, in the order of mySurfels.
+     */
+    void evalChunks( long nb, std::vector<Quantity> & values, std::false_type ) const;
+
+    /// @return the first slot of the probing sequence of @a s.
+    Index slot( const Surfel & s ) const;
+
+  }; // end of class FlatEstimatorCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatEstimatorCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatEstimatorCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TEstimator>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatEstimatorCache<TEstimator> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/FlatEstimatorCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatEstimatorCache_h
+
+#undef FlatEstimatorCache_RECURSES
+#endif // else defined(FlatEstimatorCache_RECURSES)
@@ -303,7 +303,7 @@ private:
 
   const KernelSpelFunctor myKernelFunctor;  ///< Kernel functor (on Spel)
   std::vector< PairIterators > myKernels;   ///< array of begin/end iterator of shifting masks.
-  std::vector< DigitalSet * > myKernelsSet; ///< Array of shifting masks. Size = 9 for each shifting (0-adjacent and full kernel included)
+  std::vector< CountedPtr<DigitalSet> > myKernelsSet; ///< Array of shifting masks, shared by copies. Size = 9 for each shifting (0-adjacent and full kernel included)
   CountedPtr<KernelSupport>      myKernel;      ///< Euclidean kernel
   CountedPtr<DigitalShapeKernel> myDigKernel;   ///< Digital kernel
   CountedConstPtrOrConstPtr<PointPredicate> myPointPredicate; ///< Smart pointer (if required) on a point predicate.
@@ -42,6 +42,11 @@
 // Inclusions
 #include <iostream>
 #include <functional>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/ConstAlias.h"
@@ -50,6 +55,7 @@
 #include "DGtal/topology/CSCellEmbedder.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
 #include "DGtal/geometry/volumes/distance/CMetricSpace.h"
 #include "DGtal/base/BasicFunctors.h"
@@ -92,6 +98,18 @@ namespace DGtal
    * function in the ambient space (not a geodesic one for instance) on
    * canonical embedding of surfel elements (cf CanonicSCellEmbedder).
    *
+   * The first range evaluation indexes the surfels of the whole
+   * surface (surfel vector, neighbor lists in a compressed array and
+   * embedded points). Each ball is then visited with a reusable workspace
+   * (epoch-stamped marks and a priority queue kept in a vector)
+   * instead of a fresh DistanceBreadthFirstVisitor with set-based
+   * marks. Surfels are pushed to the functor in exactly the same order
+   * as with the visitor, so estimations are unchanged. Once the index
+   * exists, single surfel evaluations use it too. If DGtal has been
+   * built with OpenMP support (WITH_OPENMP flag set to "true"),
+   * evalParallel() evaluates a range of surfels by contiguous blocks
+   * in parallel, each thread working on its own copy of the functor.
+   *
    *  @tparam TDigitalSurfaceContainer any model of digital surface container concept (CDigitalSurfaceContainer)
    *  @tparam TMetric any model of CMetricSpace to be used in the neighborhood construction.
    *  @tparam TFunctorOnSurfel an estimator on surfel set (model of CLocalEstimatorFromSurfelFunctor)
@@ -181,7 +199,13 @@ namespace DGtal
      */
     LocalEstimatorFromSurfelFunctorAdapter ( const LocalEstimatorFromSurfelFunctorAdapter & other ):
       mySurface(other.mySurface), myFunctor(other.myFunctor), myMetric(other.myMetric),
-      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor)
+      myH(other.myH), myInit(other.myInit),
+      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor),
+      myRadius(other.myRadius),
+      mySurfels(other.mySurfels), myIndices(other.myIndices),
+      myNeighborOffsets(other.myNeighborOffsets), myNeighbors(other.myNeighbors),
+      myPoints(other.myPoints), myIndexed(other.myIndexed.load()),
+      myEvaluations(0)
     {  }
     
 
@@ -196,8 +220,18 @@ namespace DGtal
       mySurface = other.mySurface;
       myFunctor = other.myFunctor;
       myMetric = other.myMetric;
+      myH = other.myH;
+      myInit = other.myInit;
       myEmbedder = other.myEmbedder;
       myConvFunctor = other.myConvFunctor;
+      myRadius = other.myRadius;
+      clearIndex();
+      mySurfels = other.mySurfels;
+      myIndices = other.myIndices;
+      myNeighborOffsets = other.myNeighborOffsets;
+      myNeighbors = other.myNeighbors;
+      myPoints = other.myPoints;
+      myIndexed = other.myIndexed.load();
       return *this;
     }
     
@@ -244,7 +278,9 @@ namespace DGtal
                     const Value radius);
 
     /**
-     * Initialisation of estimator parameters.
+     * Initialisation of estimator parameters. The surface index (the
+     * surfels, their neighbors and their embeddings) is not built
+     * here, but by the first range evaluation.
      *
      * @param[in] _h grid size (must be >0).
      * @param[in] itb iterator after the last surfel of the surface.
@@ -255,6 +291,12 @@ namespace DGtal
 
 
     /**
+     * @note This evaluation and the range evaluation use the functor
+     * and a workspace of this object: they are not reentrant and must
+     * not be called concurrently on the same object (this is asserted
+     * in debug mode). Use evalParallel for parallel evaluations. The
+     * surface index is used if a range evaluation has built it.
+     *
      * @return the estimated quantity at *it
      * @param [in] it the surfel iterator at which we evaluate the quantity.
      */
@@ -262,6 +304,9 @@ namespace DGtal
     Quantity eval(const SurfelConstIterator& it) const;
 
     /**
+     * Builds the surface index if it is not already built, then
+     * evaluates each surfel of the range.
+     *
      * @return the estimated quantity in the range [itb,ite)
      * @param [in] itb starting surfel iterator.
      * @param [in] ite end surfel iterator.
@@ -273,6 +318,31 @@ namespace DGtal
                         const SurfelConstIterator& ite,
                         OutputIterator result) const;
 
+    /**
+     * Parallel version of the range evaluation: the range is split in
+     * as many contiguous blocks as threads, each thread evaluating its
+     * block with its own copy of the functor and its own workspace.
+     * The surface index is built first if it is not already built.
+     * Results are written in the order of the range and are the same
+     * as with eval(itb,ite,result) as long as the functor evaluations
+     * only depend on the pushed surfels. Surfels that are not in the
+     * surface index are evaluated one at a time, since the visitor
+     * moves the tracker of the surface. Without OpenMP support, this
+     * is the sequential range evaluation.
+     *
+     * @pre FunctorOnSurfel must be CopyConstructible and its copies
+     * must be independent (e.g. not sharing an owned pointer).
+     *
+     * @return the estimated quantity in the range [itb,ite)
+     * @param [in] itb starting surfel iterator.
+     * @param [in] ite end surfel iterator.
+     * @param [in,out] result resulting output iterator
+     */
+    template< typename SurfelConstIterator, typename OutputIterator>
+    OutputIterator evalParallel(const SurfelConstIterator& itb,
+                                const SurfelConstIterator& ite,
+                                OutputIterator result) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -290,6 +360,109 @@ namespace DGtal
 
   private:
 
+    /// Index of a surfel in the surface index.
+    typedef std::size_t Index;
+
+    /// Point type of the metric.
+    typedef typename Metric::Point MetricPoint;
+
+    /// A node of the ball traversal: (surfel index, distance to the center).
+    typedef std::pair<Index, Value> IndexedNode;
+
+    /**
+     * Reusable state of a ball traversal: a vertex is marked if its
+     * stamp equals the current epoch, so marks are cleared in O(1)
+     * between two balls.
+     */
+    struct Workspace
+    {
+      /// The stamp of each surfel.
+      std::vector<unsigned int> marks;
+      /// The current epoch.
+      unsigned int epoch;
+      /// The priority queue, as a heap.
+      std::vector<IndexedNode> queue;
+      Workspace() : epoch( 0 ) {}
+    };
+
+    /**
+     * Counts the running sequential evaluations and asserts that there
+     * is only one (only when NDEBUG is not defined).
+     */
+    struct SequentialEvaluation
+    {
+      SequentialEvaluation( std::atomic<int> & count ) : myCount( count )
+      {
+#ifndef NDEBUG
+        ASSERT_MSG( myCount.fetch_add( 1 ) == 0,
+                    "Sequential evaluations are not reentrant, use evalParallel" );
+#endif
+      }
+      ~SequentialEvaluation()
+      {
+#ifndef NDEBUG
+        myCount.fetch_sub( 1 );
+#endif
+      }
+      std::atomic<int> & myCount;
+    };
+
+    /**
+     * Builds the surface index if it is not already built. Concurrent
+     * calls build it once.
+     */
+    void buildIndex() const;
+
+    /**
+     * Writes the neighbors of a surfel in the same order as
+     * DigitalSurface::writeNeighbors, but with the given tracker, so
+     * that threads do not share the tracker of the surface.
+     *
+     * @param tracker a tracker on the surface.
+     * @param s any surfel of the surface.
+     * @param[out] neighbors the neighbors of s are appended to it.
+     */
+    void writeNeighbors( typename DigitalSurfaceContainer::DigitalSurfaceTracker & tracker,
+                         const Surfel & s, std::vector<Surfel> & neighbors ) const;
+
+    /// Clears the surface index.
+    void clearIndex();
+
+    /**
+     * Finds the index of a surfel.
+     * @param s any surfel.
+     * @param[out] i its index if found.
+     * @return 'true' if s belongs to the surface index.
+     */
+    bool findIndex( const Surfel & s, Index & i ) const;
+
+    /**
+     * Sequential evaluation with the functor and the workspace of this
+     * object, on the surface index if s belongs to it, with the visitor
+     * otherwise.
+     * @param s the surfel at which we evaluate the quantity.
+     * @return the estimated quantity at s.
+     */
+    Quantity evalSequential( const Surfel & s ) const;
+
+    /**
+     * Evaluation with the visitor (used when the surface is not indexed).
+     * @param s the surfel at which we evaluate the quantity.
+     * @param functor the functor used for the estimation.
+     * @return the estimated quantity at s.
+     */
+    Quantity evalWithVisitor( const Surfel & s, FunctorOnSurfel & functor ) const;
+
+    /**
+     * Evaluation on the surface index.
+     * @param c the index of the surfel at which we evaluate the quantity.
+     * @param functor the functor used for the estimation.
+     * @param ws the workspace used for the ball traversal.
+     * @return the estimated quantity at surfel c.
+     */
+    Quantity evalIndexed( Index c, FunctorOnSurfel & functor,
+                          Workspace & ws ) const;
+
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -318,6 +491,33 @@ namespace DGtal
     ///Ball radius
     Value myRadius;
 
+    ///Surfels of the surface index (empty if not built)
+    mutable std::vector<Surfel> mySurfels;
+
+    ///Index of each surfel of the surface index
+    mutable std::unordered_map<Surfel, Index> myIndices;
+
+    ///Offsets of the neighbors of each indexed surfel in myNeighbors
+    mutable std::vector<Index> myNeighborOffsets;
+
+    ///Neighbors of the indexed surfels, in the order of writeNeighbors
+    mutable std::vector<Index> myNeighbors;
+
+    ///Embedded points of the indexed surfels
+    mutable std::vector<MetricPoint> myPoints;
+
+    ///True once the surface index is built
+    mutable std::atomic<bool> myIndexed;
+
+    ///Serializes the builds of the surface index
+    mutable std::mutex myIndexMutex;
+
+    ///Workspace of the sequential evaluations (hence not reentrant)
+    mutable Workspace myWorkspace;
+
+    ///Number of running sequential evaluations (checked in debug mode)
+    mutable std::atomic<int> myEvaluations;
+
   }; // end of class LocalEstimatorFromSurfelFunctorAdapter
 
   /**
@@ -0,0 +1,287 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatCubicalSubdivision.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FlatCubicalSubdivision.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatCubicalSubdivision_RECURSES)
+#error Recursive header files inclusion detected in FlatCubicalSubdivision.h
+#else // defined(FlatCubicalSubdivision_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatCubicalSubdivision_RECURSES
+
+#if !defined FlatCubicalSubdivision_h
+/** Prevents repeated inclusion of headers. */
+#define FlatCubicalSubdivision_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatCubicalSubdivision
+  /**
+     Description of template class 'FlatCubicalSubdivision' <p> \brief
+     Aim: This class is a static data structure that subdivides a
+     rectangular domain into cubical bins of size \f$ r^n \f$, like
+     SpatialCubicalSubdivision, but stores all the points in one
+     contiguous array sorted by bin. It is used for proximity queries,
+     generally to get the points at distance \a r from a given point.
+
+     The structure is built once from a range of points by a counting
+     sort on the linearized bin index (see \ref init). Bins are
+     ordered like the points of the bin domain, hence the points of
+     consecutive bins along the first axis are contiguous in memory,
+     and the points returned by \ref getPoints are in the same order
+     as with SpatialCubicalSubdivision. If DGtal has been built with
+     OpenMP support (WITH_OPENMP flag set to "true"), the bins are
+     computed and the points are scattered in parallel.
+
+     Bins are characterized by one Point and are organized as a
+     rectangular domain with lowest bin at coordinates (0,...,0).
+
+     @tparam TSpace the digital space, a model of CSpace.
+
+     Model of CopyConstructible and Assignable.
+
+     @see SpatialCubicalSubdivision, KdTree
+   */
+  template <typename TSpace>
+  class FlatCubicalSubdivision
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    typedef HyperRectDomain<Space> Domain;
+    typedef std::vector<Point> Storage;
+    typedef typename Storage::const_iterator ConstIterator;
+    typedef Linearizer<Domain, ColMajorStorage> BinLinearizer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~FlatCubicalSubdivision();
+
+    /**
+       Constructor from rectangular domain given by lowest and uppermost point.
+       The structure contains no point until \ref init is called.
+
+       @param lo the lowest point of the domain of interest.
+       @param up the uppermost point of the domain of interest.
+       @param size the edge size of each cubical bin (an integer >= 2 ).
+    */
+    FlatCubicalSubdivision( Point lo, Point up, Coordinate size );
+
+    /**
+       Stores the range of points [itb, ite) into the structure. Any
+       previously stored point is removed. As for
+       SpatialCubicalSubdivision, if the same point is given several
+       times, there are as many copies of this point in its bin.
+
+       The points are sorted by bin with a counting sort, by chunks of
+       points in parallel if OpenMP is available. There are never more
+       chunks than points per bin, so the extra memory is O(n + nbBins()).
+
+       @tparam PointConstIterator the type of const iterator on point.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+       @pre all points lie within domain().
+    */
+    template <typename PointConstIterator>
+    void init( PointConstIterator itb, PointConstIterator ite );
+
+    /// @return the rectangular domain of interest
+    const Domain& domain() const;
+
+    /// @return the rectangular domain of bins, which is a coarser grid than domain().
+    const Domain& binDomain() const;
+
+    /// @return the number of stored points.
+    Size size() const;
+
+    /// @return the number of bins.
+    Size nbBins() const;
+
+    /**
+       @param p any point within domain().
+       @return the bin in which lies \a p.
+    */
+    Point bin( Point p ) const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return its linearized index, between 0 and nbBins()-1.
+    */
+    Size binIndex( const Point& b ) const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return its lowest possible point.
+    */
+    Point lowest( Point b ) const;
+
+    /**
+       @param b any valid bin of binDomain().
+       @return its uppermost possible point.
+    */
+    Point uppermost( Point b ) const;
+
+    /**
+       @param i any bin index between 0 and nbBins()-1.
+       @return an iterator on the first point of the i-th bin.
+    */
+    ConstIterator begin( Size i ) const;
+
+    /**
+       @param i any bin index between 0 and nbBins()-1.
+       @return an iterator after the last point of the i-th bin.
+    */
+    ConstIterator end( Size i ) const;
+
+    /**
+       Pushes back in \a pts all the points in the bin domain [\a
+       bin_lo, \a bin_up] which satisfy the predicate \a pred.
+
+       @tparam PointPredicate the type of a point predicate.
+       @param[out] pts the vector where points are pushed back for output.
+       @param bin_lo the lowest bin of the bin domain.
+       @param bin_up the uppermost bin of the bin domain.
+       @param pred an arbitrary predicate on point.
+    */
+    template <typename PointPredicate>
+    void getPoints( std::vector<Point> & pts,
+                    Point bin_lo, Point bin_up, const PointPredicate & pred ) const;
+
+    /**
+       Pushes back in \a pts all the points in the bin domain [\a
+       bin_lo, \a bin_up].
+
+       @param[out] pts the vector where points are pushed back for output.
+       @param bin_lo the lowest bin of the bin domain.
+       @param bin_up the uppermost bin of the bin domain.
+    */
+    void getPoints( std::vector<Point> & pts,
+                    Point bin_lo, Point bin_up ) const;
+
+    /**
+       Pushes back in \a pts all the points whose Euclidean distance
+       to \a c is smaller or equal to \a radius.
+
+       @param[out] pts the vector where points are pushed back for output.
+       @param c any point.
+       @param radius the radius of the ball (any non-negative number).
+    */
+    void getPointsInBall( std::vector<Point> & pts,
+                          const Point & c, double radius ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// the rectangular domain representing the useful points of the space.
+    Domain myDomain;
+    /// the edge size of each bin.
+    Coordinate mySize;
+    /// the rectangular domain of bins.
+    Domain myBinDomain;
+    /// the extent of the bin domain (used for linearization).
+    Point myBinExtent;
+    /// the offsets of each bin in myPoints (nbBins()+1 values).
+    std::vector<Size> myOffsets;
+    /// all the points, sorted by bin.
+    Storage myPoints;
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// a precomputed point to improve performance of uppermost() method.
+    Point myDiag;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Calls \a f( itb, ite ) for each maximal run of contiguous points
+       of the bins in [\a bin_lo, \a bin_up].
+    */
+    template <typename RunFunctor>
+    void forEachRun( Point bin_lo, Point bin_up, RunFunctor & f ) const;
+
+  }; // end of class FlatCubicalSubdivision
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatCubicalSubdivision'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatCubicalSubdivision' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatCubicalSubdivision<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/FlatCubicalSubdivision.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatCubicalSubdivision_h
+
+#undef FlatCubicalSubdivision_RECURSES
+#endif // else defined(FlatCubicalSubdivision_RECURSES)
@@ -0,0 +1,277 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KdTree.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module KdTree.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KdTree_RECURSES)
+#error Recursive header files inclusion detected in KdTree.h
+#else // defined(KdTree_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KdTree_RECURSES
+
+#if !defined KdTree_h
+/** Prevents repeated inclusion of headers. */
+#define KdTree_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KdTree
+  /**
+     Description of template class 'KdTree' <p> \brief Aim: A static,
+     balanced k-d tree on a set of points, answering k-nearest
+     neighbors and ball (radius) queries for the Euclidean distance.
+
+     The tree is implicit: points are reordered in one contiguous
+     array so that the node of any range [b,e) is the point at
+     position (b+e)/2, its left subtree is [b,(b+e)/2) and its right
+     subtree is [(b+e)/2+1,e). Each node splits along the axis of
+     largest extent of its range. No pointer is stored.
+
+     Queries return the indices of the points in the input range
+     given at construction, sorted by increasing distance (and by
+     increasing index for equidistant points), so results do not
+     depend on the tree layout. If DGtal has been built with OpenMP
+     support (WITH_OPENMP flag set to "true"), the construction and
+     the batched queries are parallel.
+
+     @code
+     std::vector<Z3i::RealPoint> cloud = ...;
+     KdTree<Z3i::RealPoint> tree( cloud.begin(), cloud.end() );
+     std::vector<KdTree<Z3i::RealPoint>::Size> neighbors;
+     tree.kNearest( Z3i::RealPoint( 0.5, 1.0, 2.0 ), 8, neighbors );
+     @endcode
+
+     @tparam TPoint the type of points, e.g. a PointVector with
+     integer or real coordinates (any type providing a static
+     member 'dimension' and an operator[]).
+
+     Model of CopyConstructible and Assignable.
+
+     @see FlatCubicalSubdivision
+   */
+  template <typename TPoint>
+  class KdTree
+  {
+  public:
+    typedef KdTree<TPoint> Self;
+    typedef TPoint Point;
+    typedef typename Point::Coordinate Coordinate;
+    typedef std::vector<Point> PointContainer;
+    typedef std::size_t Size;
+    typedef std::vector<Size> IndexContainer;
+    static const Dimension dimension = Point::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The empty tree.
+     */
+    KdTree();
+
+    /**
+       Constructor from a range of points.
+
+       @tparam PointConstIterator the type of const iterator on point.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+    */
+    template <typename PointConstIterator>
+    KdTree( PointConstIterator itb, PointConstIterator ite );
+
+    /**
+     * Destructor.
+     */
+    ~KdTree();
+
+    /**
+       Builds the tree on the range of points [itb, ite). Any
+       previous data is lost.
+
+       @tparam PointConstIterator the type of const iterator on point.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+    */
+    template <typename PointConstIterator>
+    void init( PointConstIterator itb, PointConstIterator ite );
+
+    /// @return the number of points in the tree.
+    Size size() const;
+
+    /**
+       @param i the index of a point in the input range (i < size()).
+       @return this point.
+    */
+    const Point & point( Size i ) const;
+
+    // ----------------------- Query services ---------------------------------
+  public:
+
+    /**
+       @tparam TQueryPoint any point type with an operator[].
+       @param q any point.
+       @return the index of the point of the tree closest to \a q.
+       @pre size() > 0
+    */
+    template <typename TQueryPoint>
+    Size nearest( const TQueryPoint & q ) const;
+
+    /**
+       Computes the \a k points of the tree closest to \a q.
+
+       @tparam TQueryPoint any point type with an operator[].
+       @param q any point.
+       @param k the number of neighbors.
+       @param[out] result the indices of the min(k,size()) closest
+       points, sorted by increasing distance (cleared first).
+    */
+    template <typename TQueryPoint>
+    void kNearest( const TQueryPoint & q, Size k, IndexContainer & result ) const;
+
+    /**
+       Computes the points of the tree within the closed ball of
+       center \a q and radius \a radius.
+
+       @tparam TQueryPoint any point type with an operator[].
+       @param q any point.
+       @param radius the radius of the ball.
+       @param[out] result the indices of the points in the ball, sorted
+       by increasing distance (cleared first).
+    */
+    template <typename TQueryPoint>
+    void inBall( const TQueryPoint & q, double radius, IndexContainer & result ) const;
+
+    /**
+       Batched k-nearest neighbors queries, in parallel if DGtal is
+       built with OpenMP.
+
+       @tparam TQueryPoint any point type with an operator[].
+       @param queries the query points.
+       @param k the number of neighbors.
+       @param[out] results the result of kNearest for each query point.
+    */
+    template <typename TQueryPoint>
+    void kNearest( const std::vector<TQueryPoint> & queries, Size k,
+                   std::vector<IndexContainer> & results ) const;
+
+    /**
+       Batched ball queries, in parallel if DGtal is built with OpenMP.
+
+       @tparam TQueryPoint any point type with an operator[].
+       @param queries the query points.
+       @param radius the radius of the balls.
+       @param[out] results the result of inBall for each query point.
+    */
+    template <typename TQueryPoint>
+    void inBall( const std::vector<TQueryPoint> & queries, double radius,
+                 std::vector<IndexContainer> & results ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The points in the tree order.
+    PointContainer myPoints;
+    /// The input index of the point at each position of the tree.
+    IndexContainer myOrder;
+    /// The position in the tree of each input point (inverse of myOrder).
+    IndexContainer myRanks;
+    /// The split axis of the node at each position of the tree.
+    std::vector<Dimension> myAxes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// A candidate neighbor: (squared distance, input index).
+    typedef std::pair<double, Size> Candidate;
+
+    /// Builds the subtree of range [b,e).
+    void build( Size b, Size e, unsigned int depth );
+
+    /// @return the squared distance between the i-th point of the tree and q.
+    template <typename TQueryPoint>
+    double distance2( Size i, const TQueryPoint & q ) const;
+
+    /// k-nearest neighbors search in the subtree of range [b,e).
+    template <typename TQueryPoint>
+    void searchKNearest( Size b, Size e, const TQueryPoint & q, Size k,
+                         std::vector<Candidate> & heap ) const;
+
+    /// Ball search in the subtree of range [b,e).
+    template <typename TQueryPoint>
+    void searchBall( Size b, Size e, const TQueryPoint & q, double r2,
+                     std::vector<Candidate> & found ) const;
+
+  }; // end of class KdTree
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KdTree'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KdTree' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const KdTree<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/KdTree.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KdTree_h
+
+#undef KdTree_RECURSES
+#endif // else defined(KdTree_RECURSES)
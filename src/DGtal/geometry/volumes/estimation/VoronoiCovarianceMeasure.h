@@ -42,6 +42,8 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -50,7 +52,7 @@
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
-#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/geometry/tools/FlatCubicalSubdivision.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -64,8 +66,18 @@ namespace DGtal
    * of a set of points. It can compute the covariance measure of an
    * arbitrary function with given support.
    *
-   * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * The Voronoi covariance matrices of the input points are stored
+   * in two parallel arrays: the sorted array of points (see \ref
+   * points) and the array of matrices (see \ref matrices). The
+   * matrix of a point is found by \ref index. You may also obtain
+   * the whole sequence (Point,VCM) as a map with \ref vcmMap.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag
+   * set to "true"), the accumulation of the Voronoi cells in \ref
+   * init and the batched \ref measure are computed in parallel. The
+   * slices of the domain are accumulated by fixed chunks summed in
+   * order, so that the result does not depend on the number of
+   * threads.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -89,7 +101,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
-    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
+    typedef DGtal::FlatCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
 
     /**
        A predicate that returns 'true' whenever the given binary image contains 'true'.
@@ -120,6 +132,7 @@ namespace DGtal
                                  Space::dimension > MatrixNN; ///< the type for nxn matrix of real numbers.
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
 
     // ----------------------- Standard services ------------------------------
@@ -182,8 +195,26 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built from \ref points and \ref matrices at
+    /// the first call after \ref init. Prefer these arrays for speed.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the (sorted) points of K, i.e. the sites of the Voronoi cells.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& points() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell,
+    /// in the same order as \ref points.
+    /// @note empty if \ref init has not been called.
+    const MatrixNNContainer& matrices() const;
+
+    /**
+       @param p any digital point.
+       @return the index of \a p in \ref points and \ref matrices,
+       or points().size() if \a p is not a point of K.
+    */
+    Size index( const Point& p ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -200,6 +231,26 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    moved at each point of \a pts. Computations are done in parallel
+    if DGtal is built with OpenMP.
+
+    @tparam Point2ScalarFunction the type of a functor
+    Point->Scalar (see \ref measure).
+
+    @param[in] chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r.
+
+    @param[in] pts the points where the kernel function is moved. They
+    must lie within domain.
+
+    @param[out] vcms the VCM at each point of \a pts (resized to pts.size()).
+    */
+    template <typename Point2ScalarFunction>
+    void measure( Point2ScalarFunction chi_r, const PointContainer& pts,
+                  MatrixNNContainer& vcms ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -235,8 +286,12 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The sorted points of K.
+    PointContainer myPoints;
+    /// The VCM of each point of K (same order as myPoints).
+    MatrixNNContainer myMatrices;
+    /// The map point -> VCM, lazily built by vcmMap().
+    mutable Point2MatrixNN myVCM;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -269,6 +324,16 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Adds to \a vcms the contributions of the points of the domain
+       whose last coordinate is \a z.
+
+       @param z the last coordinate of the slice of the domain.
+       @param[in,out] vcms the matrices of the sites touched so far,
+       indexed as myPoints.
+    */
+    void accumulateSlice( Integer z, std::map<Size, MatrixNN>& vcms ) const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -45,10 +45,12 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/RingBuffer.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/topology/DomainAdjacency.h"
 #include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+#include "DGtal/graph/EpochMarkSet.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -85,6 +87,32 @@ namespace DGtal
          visitor.expand();
        }
      @endcode
+
+  A visitor may be reused for several traversals in the same graph
+  with reset(), which empties its mark set and its queue. The node
+  queue is a RingBuffer and the neighbors of the expanded vertex are
+  written in a member buffer, so that a reset visitor does not
+  allocate memory as long as its traversals are not larger than the
+  previous ones. If the mark set is an EpochMarkSet, its clear() is
+  O(1) as well: a visitor per thread, built once and reset for every
+  seed, then performs many small (e.g. bounded-radius) traversals
+  without allocation.
+
+  @code
+     typedef EpochMarkSet< DomainPointIndexer< Domain > > MarkSet;
+     BreadthFirstVisitor< Graph, MarkSet > visitor( g, MarkSet( DomainPointIndexer< Domain >( domain ) ) );
+     for ( ... each seed p ... )
+       {
+         visitor.reset( p );
+         while ( ! visitor.finished() && visitor.current().second <= radius )
+           visitor.expand();
+       }
+  @endcode
+
+  @tparam TMarkSet the type that is used to store marked
+  vertices. Should be a set of Vertex, hence a model of CSet, which
+  also provides clear() (e.g. the VertexSet of the graph, or an
+  EpochMarkSet).
     
    @see testBreadthFirstVisitor.cpp
    @see testObject.cpp
@@ -114,7 +142,7 @@ namespace DGtal
     /// initial point or set.
     typedef std::pair< Vertex, Data > Node;
     /// Internal data structure for computing the breadth-first expansion.
-    typedef std::queue< Node > NodeQueue;
+    typedef RingBuffer< Node > NodeQueue;
     /// Internal data structure for storing vertices.
     typedef std::vector< Vertex > VertexList;
 
@@ -166,6 +194,39 @@ namespace DGtal
     BreadthFirstVisitor( ConstAlias<Graph> graph, 
                          VertexIterator b, VertexIterator e );
 
+    /**
+     * Constructor from the graph and a mark set. The visitor is in
+     * the state 'finished()' and should be started with reset(). It is
+     * the way to give a visitor a mark set that cannot be default
+     * constructed, like an EpochMarkSet.
+     *
+     * @param graph the graph in which the breadth first traversal takes place.
+     * @param marks an empty mark set, which is copied.
+     */
+    BreadthFirstVisitor( ConstAlias<Graph> graph, const MarkSet & marks );
+
+    /**
+     * Restarts the traversal from a point, which provides the new
+     * initial core. The mark set and the queue are emptied without
+     * releasing their memory.
+     *
+     * @param p any vertex of the graph.
+     */
+    void reset( const Vertex & p );
+
+    /**
+       Restarts the traversal from a range of vertices, which provides
+       the new initial core (see the constructor from iterators). The
+       mark set and the queue are emptied without releasing their
+       memory.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+    */
+    template <typename VertexIterator>
+    void reset( VertexIterator b, VertexIterator e );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -288,6 +349,11 @@ namespace DGtal
      */
     NodeQueue myQueue;
 
+    /**
+       Buffer where the neighbors of the expanded vertex are written.
+     */
+    VertexList myNeighbors;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -46,6 +46,7 @@
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+#include "DGtal/graph/EpochMarkSet.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -89,7 +90,9 @@ namespace DGtal
   neighbors.
 
   @tparam TMarkSet the type that is used to store marked
-  vertices. Should be a set of Vertex, hence a model of CSet.
+  vertices. Should be a set of Vertex, hence a model of CSet, which
+  also provides clear() (e.g. the VertexSet of the graph, or an
+  EpochMarkSet).
  
   @code
      #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -196,6 +199,13 @@ while ( ! visitor.finished() )
     }
    @endcode
 
+   As BreadthFirstVisitor, a visitor may be reused for several
+   traversals with reset(), possibly with a new distance object
+   (typically the distance to the new seed). The priority queue and
+   the neighbor buffer keep their memory, and so does the mark set if
+   it is an EpochMarkSet (given to the constructor without initial
+   core), whose clear() is O(1).
+
    @see testDistancePropagation.cpp
    @see testObject.cpp
    */
@@ -259,8 +269,17 @@ while ( ! visitor.finished() )
       }
     };
 
-    /// Internal data structure for computing the distance ordering expansion.
-    typedef std::priority_queue< Node > NodeQueue;
+    /// Internal data structure for computing the distance ordering
+    /// expansion: a priority queue that can be emptied without
+    /// releasing its memory.
+    struct NodeQueue : public std::priority_queue< Node >
+    {
+      /// Empties the queue, keeping its storage.
+      inline void clear()
+      {
+        this->c.clear();
+      }
+    };
     /// Internal data structure for storing vertices.
     typedef std::vector< Vertex > VertexList;
 
@@ -309,6 +328,40 @@ while ( ! visitor.finished() )
                      const VertexFunctor & distance,
                      VertexIterator b, VertexIterator e );
 
+    /**
+     * Constructor from a graph, a vertex functor and a mark set. The
+     * visitor is in the state 'finished()' and should be started with
+     * reset(). It is the way to give a visitor a mark set that cannot
+     * be default constructed, like an EpochMarkSet.
+     *
+     * @param graph the graph in which the distance ordering traversal takes place (aliased).
+     * @param distance the distance object, a functor Vertex -> Scalar (cloned).
+     * @param marks an empty mark set, which is copied.
+     */
+    DistanceBreadthFirstVisitor( ConstAlias<Graph> graph, 
+                     const VertexFunctor & distance,
+                     const MarkSet & marks );
+
+    /**
+     * Restarts the traversal from a point, which provides the new
+     * initial core, with the same distance object. The mark set and
+     * the queue are emptied without releasing their memory.
+     *
+     * @param p any vertex of the graph.
+     */
+    void reset( const Vertex & p );
+
+    /**
+     * Restarts the traversal from a point, which provides the new
+     * initial core, with a new distance object. The mark set and the
+     * queue are emptied without releasing their memory.
+     *
+     * @param distance the new distance object (copied, hence the
+     * VertexFunctor should be assignable).
+     * @param p any vertex of the graph.
+     */
+    void reset( const VertexFunctor & distance, const Vertex & p );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -500,6 +553,11 @@ while ( ! visitor.finished() )
      */
     NodeQueue myQueue;
 
+    /**
+       Buffer where the neighbors of the expanded vertex are written.
+     */
+    VertexList myNeighbors;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -0,0 +1,360 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file EpochMarkSet.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module EpochMarkSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(EpochMarkSet_RECURSES)
+#error Recursive header files inclusion detected in EpochMarkSet.h
+#else // defined(EpochMarkSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define EpochMarkSet_RECURSES
+
+#if !defined EpochMarkSet_h
+/** Prevents repeated inclusion of headers. */
+#define EpochMarkSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DomainPointIndexer
+  /**
+     Description of template class 'DomainPointIndexer' <p> \brief
+     Aim: Numbers the points of a HyperRectDomain from 0 to
+     size()-1 (row-major linearization). It is a vertex indexer for
+     EpochMarkSet, for graphs whose vertices are points (e.g. Object).
+
+     @tparam TDomain the type of domain, a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DomainPointIndexer
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef Point Vertex;
+    typedef std::size_t Size;
+
+    /// Default constructor: an indexer of an empty domain.
+    DomainPointIndexer();
+
+    /**
+     * Constructor.
+     * @param domain the domain whose points are numbered.
+     */
+    DomainPointIndexer( const Domain & domain );
+
+    /// @return the number of points of the domain.
+    Size size() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of @a p, in [0,size()[.
+     */
+    Size operator()( const Vertex & p ) const;
+
+  private:
+    /// The lowest point of the domain.
+    Point myLower;
+    /// The stride of each axis.
+    Size myStrides[ Point::dimension ];
+    /// The number of points.
+    Size mySize;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KSpaceSCellIndexer
+  /**
+     Description of template class 'KSpaceSCellIndexer' <p> \brief
+     Aim: Numbers the signed cells of a bounded cellular grid space
+     from 0 to size()-1, from their Khalimsky coordinates and their
+     sign. It is a vertex indexer for EpochMarkSet, for graphs whose
+     vertices are signed cells (e.g. DigitalSurface).
+
+     @tparam TKSpace the type of cellular grid space (a model of CCellularGridSpaceND).
+   */
+  template <typename TKSpace>
+  class KSpaceSCellIndexer
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef SCell Vertex;
+    typedef std::size_t Size;
+
+    /// Default constructor: an indexer of an empty space.
+    KSpaceSCellIndexer();
+
+    /**
+     * Constructor.
+     * @param K the (bounded) space whose signed cells are numbered.
+     */
+    KSpaceSCellIndexer( const KSpace & K );
+
+    /// @return the number of signed cells of the space.
+    Size size() const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return the index of @a c, in [0,size()[.
+     */
+    Size operator()( const Vertex & c ) const;
+
+  private:
+    /// The lowest Khalimsky coordinates.
+    Point myLower;
+    /// The stride of each axis.
+    Size myStrides[ Point::dimension ];
+    /// The number of signed cells.
+    Size mySize;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class EpochMarkSet
+  /**
+     Description of template class 'EpochMarkSet' <p> \brief Aim: A set
+     of vertices stored as a dense array of epoch stamps, whose clear()
+     is O(1). It is designed as the mark set of graph visitors
+     (BreadthFirstVisitor, DistanceBreadthFirstVisitor) running many
+     small traversals in a large graph.
+
+     Vertices are numbered by a vertex indexer, and the set stores, for
+     each possible index, the epoch at which the vertex was inserted.
+     A vertex belongs to the set iff its stamp is the current epoch, so
+     that clearing the set is only incrementing the epoch. Members are
+     also listed in a vector, which gives iteration and size() in time
+     proportional to the number of members, and O(1) erasure (the last
+     member takes the place of the erased one).
+
+     Memory is allocated once, at construction, proportionally to the
+     number of indices (four bytes for the stamp and the size of an
+     index for the position of the member). Afterwards, as long as the
+     set is reused (with clear()), insertions do not allocate memory
+     beyond the capacity reached by the member list.
+
+     The set provides the services of a unique associative container
+     that are used by graph visitors (find, count, insert, erase,
+     clear, iteration), but cannot be built from a range without
+     an indexer: it is thus not a model of
+     boost::UniqueAssociativeContainer.
+
+     @code
+     typedef BreadthFirstVisitor< MyDigitalSurface,
+       EpochMarkSet< KSpaceSCellIndexer< KSpace > > > Visitor;
+     KSpaceSCellIndexer< KSpace > indexer( K );
+     Visitor visitor( surface, Visitor::MarkSet( indexer ) );
+     for ( ... each seed s ... )
+       {
+         visitor.reset( s ); // no allocation, O(1) clear of the marks
+         while ( ! visitor.finished() && visitor.current().second <= r )
+           visitor.expand();
+       }
+     @endcode
+
+     @tparam TVertexIndexer the type of a vertex indexer: it defines
+     an inner type Vertex, a method size() and an operator() mapping a
+     Vertex to an index in [0,size()[, e.g. DomainPointIndexer or
+     KSpaceSCellIndexer.
+
+     @see testBreadthFirstPropagation.cpp
+   */
+  template <typename TVertexIndexer>
+  class EpochMarkSet
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef EpochMarkSet<TVertexIndexer> Self;
+    typedef TVertexIndexer VertexIndexer;
+    typedef typename VertexIndexer::Vertex Vertex;
+    typedef Vertex value_type;
+    typedef Vertex key_type;
+    typedef std::size_t Size;
+    typedef Size size_type;
+    /// The type of an epoch.
+    typedef DGtal::uint32_t Stamp;
+    typedef typename std::vector<Vertex>::const_iterator ConstIterator;
+    typedef ConstIterator const_iterator;
+    /// Members cannot be modified in place.
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor: a set with no possible vertex, useful only
+     * as a placeholder.
+     */
+    EpochMarkSet();
+
+    /**
+     * Constructor. Allocates the stamps of all possible vertices.
+     * @param indexer the vertex indexer.
+     */
+    EpochMarkSet( const VertexIndexer & indexer );
+
+    /**
+     * Destructor.
+     */
+    ~EpochMarkSet();
+
+    /**
+     * Swaps the content of 'this' with the one of @a other. O(1).
+     * @param other any other set.
+     */
+    void swap( EpochMarkSet & other );
+
+    /// @return a const reference on the vertex indexer.
+    const VertexIndexer & indexer() const;
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /// @return the number of vertices in the set.
+    Size size() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+
+    /// @return an iterator on the first member.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last member.
+    ConstIterator end() const;
+
+    /**
+     * @param v any vertex.
+     * @return an iterator on @a v if it is in the set, end() otherwise. O(1).
+     */
+    ConstIterator find( const Vertex & v ) const;
+
+    /**
+     * @param v any vertex.
+     * @return 1 if @a v is in the set, 0 otherwise. O(1).
+     */
+    Size count( const Vertex & v ) const;
+
+    /**
+     * Inserts a vertex. O(1) amortized.
+     * @param v any vertex.
+     * @return an iterator on @a v and 'true' iff @a v was not already in the set.
+     */
+    std::pair<ConstIterator, bool> insert( const Vertex & v );
+
+    /**
+     * Inserts a range of vertices.
+     * @tparam VertexIterator any type of single pass iterator on vertices.
+     * @param b the begin iterator.
+     * @param e the end iterator.
+     */
+    template <typename VertexIterator>
+    void insert( VertexIterator b, VertexIterator e );
+
+    /**
+     * Removes the member pointed by @a it. O(1). Invalidates the
+     * iterators on the last member.
+     * @param it any valid iterator on a member.
+     */
+    void erase( ConstIterator it );
+
+    /**
+     * Removes a vertex. O(1).
+     * @param v any vertex.
+     * @return the number of removed vertices (0 or 1).
+     */
+    Size erase( const Vertex & v );
+
+    /**
+     * Empties the set, in O(1) (the stamps are reset only once every
+     * 2^32 calls).
+     */
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The vertex indexer.
+    VertexIndexer myIndexer;
+    /// The current epoch, never 0.
+    Stamp myEpoch;
+    /// The epoch at which each possible vertex was inserted.
+    std::vector<Stamp> myStamps;
+    /// The position in myVertices of each member (only valid for members).
+    std::vector<Size> myPositions;
+    /// The members.
+    std::vector<Vertex> myVertices;
+
+  }; // end of class EpochMarkSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'EpochMarkSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'EpochMarkSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TVertexIndexer>
+  std::ostream&
+  operator<< ( std::ostream & out, const EpochMarkSet<TVertexIndexer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/EpochMarkSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined EpochMarkSet_h
+
+#undef EpochMarkSet_RECURSES
+#endif // else defined(EpochMarkSet_RECURSES)
@@ -0,0 +1,376 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LevelSynchronousExpander.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module LevelSynchronousExpander.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LevelSynchronousExpander_RECURSES)
+#error Recursive header files inclusion detected in LevelSynchronousExpander.h
+#else // defined(LevelSynchronousExpander_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LevelSynchronousExpander_RECURSES
+
+#if !defined LevelSynchronousExpander_h
+/** Prevents repeated inclusion of headers. */
+#define LevelSynchronousExpander_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LevelSynchronousExpander
+  /**
+     Description of template class 'LevelSynchronousExpander' <p>
+     \brief Aim: Computes the topological distance layers of a digital
+     object from a set of seeds, as Expander, but level by level and in
+     parallel, for huge objects given in a dense way (an image, a point
+     predicate, a digital set) within a HyperRectDomain.
+
+     The object is stored as a bitset over the domain, padded with one
+     empty voxel in every direction (and along the first axis up to a
+     multiple of 64), so that the neighbors of a voxel are obtained by
+     adding constant offsets to its index. The adjacency is the metric
+     adjacency of MetricAdjacency: two points are adjacent if they
+     differ by at most 1 on each coordinate and by at most maxNorm1 in
+     l1 norm (e.g. 1 for 6-adjacency in 3D, 2 for 18-, 3 for 26-).
+
+     The expansion is level-synchronous: all the voxels at distance d
+     are found before the ones at distance d+1. Each level is computed
+     in one of two ways (direction-optimizing breadth-first search,
+     Beamer et al. 2012):
+
+     - top-down: the voxels of the frontier (a list of indices) are
+       shared among threads, and each thread claims the unvisited
+       neighbors with an atomic test-and-set in the bitset of visited
+       voxels;
+
+     - bottom-up: the frontier is a bitset, and every unvisited voxel
+       of the object looks for a neighbor in it. Threads share the
+       words of the bitsets, hence no synchronization is needed, and a
+       voxel stops at its first neighbor in the frontier.
+
+     Top-down is chosen while the frontier is small, bottom-up when the
+     frontier is larger than a fraction of the unvisited voxels (see
+     setDirectionParameters). Threads are used if DGtal has been built
+     with OpenMP support (WITH_OPENMP flag set to "true").
+
+     @code
+     typedef LevelSynchronousExpander<Z3i::Domain> LSExpander;
+     LSExpander expander( image.domain(), 1 ); // 6-adjacency
+     expander.setObject( predicate );         // e.g. a thresholded image
+     expander.expand( seed );
+     LSExpander::DistanceImage layers = expander.distanceImage();
+     @endcode
+
+     @tparam TDomain the type of domain, a HyperRectDomain.
+
+     @see testLevelSynchronousExpander.cpp
+   */
+  template <typename TDomain>
+  class LevelSynchronousExpander
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef LevelSynchronousExpander<TDomain> Self;
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef std::size_t Size;
+    /// Index of a voxel in the padded domain.
+    typedef std::size_t Index;
+    /// Topological distance to the seeds.
+    typedef DGtal::uint32_t Distance;
+    /// Image of the distance layers.
+    typedef ImageContainerBySTLVector<Domain, Distance> DistanceImage;
+    /// Word of the bitsets.
+    typedef DGtal::uint64_t Word;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object is empty.
+     *
+     * @param domain the domain of the object.
+     * @param maxNorm1 the adjacency: adjacent points differ by at
+     * most 1 on each coordinate and by at most @a maxNorm1 in l1 norm
+     * (between 1 and the dimension).
+     */
+    LevelSynchronousExpander( const Domain & domain, unsigned int maxNorm1 = 1 );
+
+    /**
+     * Destructor.
+     */
+    ~LevelSynchronousExpander();
+
+    /**
+     * Sets the object, in parallel.
+     *
+     * @tparam TPointPredicate any type with a const operator() from
+     * Point to bool (e.g. a digital set, a thresholded image), which
+     * may be called by several threads at once.
+     *
+     * @param object the predicate of the points of the object.
+     */
+    template <typename TPointPredicate>
+    void setObject( const TPointPredicate & object );
+
+    /**
+     * Sets the switch between top-down and bottom-up levels. A level
+     * is computed bottom-up when the frontier size times @a alpha is
+     * greater than the number of unvisited voxels of the object, and
+     * the expansion goes back to top-down levels when the frontier size
+     * times @a beta is smaller than the size of the object.
+     *
+     * @param alpha the top-down to bottom-up parameter (default 14, 0
+     * means top-down only).
+     * @param beta the bottom-up to top-down parameter (default 24, 0
+     * means that the expansion never goes back to top-down).
+     */
+    void setDirectionParameters( double alpha, double beta );
+
+    // ----------------------- Expansion services ------------------------------
+  public:
+
+    /**
+     * Computes the distance layers from one seed.
+     *
+     * @param seed the seed (ignored if not in the object).
+     * @param maxDistance the expansion stops at this distance.
+     * @return the number of layers.
+     */
+    Size expand( const Point & seed,
+                 Distance maxDistance = infiniteDistance() );
+
+    /**
+     * Computes the distance layers from a set of seeds, which form
+     * the layer 0.
+     *
+     * @tparam PointIterator any type of single pass iterator on points.
+     * @param b the begin iterator on seeds.
+     * @param e the end iterator on seeds (seeds outside the object are
+     * ignored).
+     * @param maxDistance the expansion stops at this distance.
+     * @return the number of layers.
+     */
+    template <typename PointIterator>
+    Size expand( PointIterator b, PointIterator e,
+                 Distance maxDistance = infiniteDistance() );
+
+    /// @return the distance given to unreached voxels.
+    static Distance infiniteDistance();
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the domain.
+    const Domain & domain() const;
+
+    /// @return the number of voxels of the object.
+    Size size() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return 'true' iff @a p is in the object.
+     */
+    bool inObject( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the distance of @a p to the seeds, or
+     * infiniteDistance() if @a p was not reached.
+     */
+    Distance distance( const Point & p ) const;
+
+    /// @return the number of layers of the last expansion.
+    Size nbLayers() const;
+
+    /// @return the number of voxels of each layer of the last expansion.
+    const std::vector<Size> & layerSizes() const;
+
+    /// @return the number of voxels reached by the last expansion.
+    Size nbVisited() const;
+
+    /// @return the number of layers computed bottom-up in the last expansion.
+    Size nbBottomUpLayers() const;
+
+    /**
+     * @return the image of the distances to the seeds (with
+     * infiniteDistance() outside the object or for unreached voxels),
+     * filled in parallel.
+     */
+    DistanceImage distanceImage() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain.
+    Domain myDomain;
+    /// The lowest point of the domain.
+    Point myLower;
+    /// The number of points of the domain along each axis.
+    Point myExtent;
+    /// The stride of each axis in the padded domain.
+    Index myStrides[ Point::dimension ];
+    /// The number of voxels of the padded domain (a multiple of 64).
+    Index myPaddedSize;
+    /// The index offsets of the neighbors.
+    std::vector<std::ptrdiff_t> myOffsets;
+    /// Bitset of the object.
+    std::vector<Word> myObject;
+    /// Bitset of the visited voxels.
+    std::vector<Word> myVisited;
+    /// Bitset of the frontier (bottom-up levels).
+    std::vector<Word> myFrontierBits;
+    /// Bitset of the next frontier (bottom-up levels).
+    std::vector<Word> myNextBits;
+    /// Frontier (top-down levels).
+    std::vector<Index> myFrontier;
+    /// Per thread lists of discovered voxels (top-down levels).
+    std::vector< std::vector<Index> > myDiscovered;
+    /// Distance of each voxel of the padded domain.
+    std::vector<Distance> myDistances;
+    /// Number of voxels of the object.
+    Size mySize;
+    /// Sizes of the layers of the last expansion.
+    std::vector<Size> myLayerSizes;
+    /// Number of bottom-up layers of the last expansion.
+    Size myNbBottomUp;
+    /// Top-down to bottom-up parameter.
+    double myAlpha;
+    /// Bottom-up to top-down parameter.
+    double myBeta;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    LevelSynchronousExpander();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    LevelSynchronousExpander ( const LevelSynchronousExpander & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    LevelSynchronousExpander & operator= ( const LevelSynchronousExpander & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the index of @a p in the padded domain.
+    Index index( const Point & p ) const;
+
+    /// @return 'true' iff bit @a i of @a bits is set.
+    static bool getBit( const std::vector<Word> & bits, Index i );
+
+    /**
+     * Sets bit @a i of @a bits, atomically when threads are used.
+     * @return 'true' iff the bit was not set before.
+     */
+    static bool testAndSet( std::vector<Word> & bits, Index i );
+
+    /**
+     * Computes the layer @a d from the frontier list, top-down.
+     * @return the size of the layer, which becomes the frontier list.
+     */
+    Size topDownStep( Distance d );
+
+    /**
+     * Computes the layer @a d from the frontier bitset, bottom-up.
+     * @return the size of the layer, which becomes the frontier bitset.
+     */
+    Size bottomUpStep( Distance d );
+
+    /// Fills the frontier bitset from the frontier list.
+    void frontierListToBits();
+
+    /// Fills the frontier list from the frontier bitset.
+    void frontierBitsToList();
+
+  }; // end of class LevelSynchronousExpander
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LevelSynchronousExpander'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LevelSynchronousExpander' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const LevelSynchronousExpander<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/LevelSynchronousExpander.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LevelSynchronousExpander_h
+
+#undef LevelSynchronousExpander_RECURSES
+#endif // else defined(LevelSynchronousExpander_RECURSES)
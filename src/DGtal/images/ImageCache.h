@@ -219,6 +219,7 @@ public:
     void incCacheMissRead()
     {
         cacheMissRead++;
+        DGTAL_PROFILE_COUNT( "ImageCache read misses", 1 );
     }
     
     /**
@@ -227,6 +228,7 @@ public:
     void incCacheMissWrite()
     {
         cacheMissWrite++;
+        DGTAL_PROFILE_COUNT( "ImageCache write misses", 1 );
     }
     
     /**
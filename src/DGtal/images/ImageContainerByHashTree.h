@@ -42,6 +42,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -116,6 +117,22 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * Only the leaves of the tree are stored. The nodes are stored
+   * contiguously in an arena (a vector) and are found from their
+   * keys with an open-addressing (linear probing) hash table of
+   * indices, which grows with the number of nodes. Accessing a
+   * point walks up its ancestors until a leaf is found, but the last
+   * leaf found is cached so that spatially coherent accesses
+   * (scanning a domain, neighborhoods) usually cost a single key
+   * comparison. As a consequence, concurrent reads of the same image
+   * are not thread-safe. Pointers to nodes (getNode) are invalidated
+   * when nodes are added or removed.
+   *
+   * A tree is built from a dense image much faster with build(),
+   * which compresses the uniform blocks bottom-up, in parallel if
+   * DGtal has been built with OpenMP, than by calling setValue() on
+   * each point.
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @tparam THashKey  type to store Morton keys
@@ -176,11 +193,8 @@ namespace DGtal
      * The constructor from a \a hashKeySize, a @a depth and a
      * @a defaultValue.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Log2 of the initial size of the hash table
+     * (it grows with the number of nodes).
      *
      * @param depth Determines the maximum depth of the tree and thus
      * qthe "size" of the image. Each span then extends from 0 to
@@ -199,11 +213,8 @@ namespace DGtal
      * of the tree is given by the logarithm of the domain size
      * defined by the two points.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Log2 of the initial size of the hash table
+     * (it grows with the number of nodes).
      *
      * @param p1 First point of the image bounding box.
      * @param p2 Second point of the image bounding box.
@@ -223,11 +234,8 @@ namespace DGtal
      * defined by the two points.
      *
      * @param aDomain the image domain
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here (default: 3).
+     * @param hashKeySize Log2 of the initial size of the hash table
+     * (it grows with the number of nodes, default: 3).
      *
      * @param defaultValue In order for the tree to be valid it needs
      * a default value at the root (key = 1)
@@ -236,27 +244,25 @@ namespace DGtal
                              const unsigned int hashKeySize = 3,
                              const Value defaultValue= NumberTraits<Value>::ZERO);
 
-
-    // TODO
-    // /*
-    //  * Copy contructor.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
-
-    // /*
-    //  * Assignment.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
-
-    // /*
-    //  * Destructor
-    //  * Free the memory allocated by @a myData
-    //  */
-    // ~ImageContainerByHashTree();
+    /**
+     * Replaces the values of the tree by the values of a dense image,
+     * building the tree bottom-up: the values of the finest level are
+     * read in Morton order, then each level is computed from the
+     * level below by merging the blocks of 2^dim uniform children of
+     * same value. Each level is computed in parallel if DGtal has been
+     * built with OpenMP. The resulting tree does not depend on the
+     * number of threads and is the most compressed one.
+     *
+     * The points of the tree span which are outside the domain may
+     * take any value, so that they are merged with their neighbors.
+     *
+     * @tparam TConstImage any model of CConstImage with the same Point
+     * type, whose values are convertible to Value.
+     * @param anImage an image whose domain contains the domain of
+     * this tree.
+     */
+    template <typename TConstImage>
+    void build( const TConstImage & anImage );
 
 
     /**
@@ -495,16 +501,11 @@ namespace DGtal
     class Iterator
     {
     public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
+      Iterator(Node* data, unsigned int position, unsigned int arraySize)
       {
         myArraySize = arraySize;
         myContainerData = data;
-        myNode = data[0];
         myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
       }
       bool isAtEnd()const
       {
@@ -512,7 +513,7 @@ namespace DGtal
       }
       Value& operator*()
       {
-        return myNode->getObject();
+        return myContainerData[myCurrentCell].getObject();
       }
       bool operator ++ ()
       {
@@ -523,25 +524,21 @@ namespace DGtal
         if (isAtEnd() && it.isAtEnd())
           return true;
         else
-          return (myNode == it.myNode);
+          return (myCurrentCell == it.myCurrentCell);
       }
       bool operator != (const Iterator& it)
       {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
+        return !( *this == it );
       }
       inline HashKey getKey() const
       {
-        return myNode->getKey();
+        return myContainerData[myCurrentCell].getKey();
       }
       bool next();
     protected:
-      Node* myNode;
       unsigned int myCurrentCell;
       unsigned int myArraySize;
-      Node** myContainerData;
+      Node* myContainerData;
     };
 
     /**
@@ -549,7 +546,7 @@ namespace DGtal
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return Iterator(myNodes.empty() ? 0 : &myNodes[0], 0, (unsigned int) myNodes.size());
     }
 
     /**
@@ -557,7 +554,8 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return Iterator(myNodes.empty() ? 0 : &myNodes[0], (unsigned int) myNodes.size(),
+                      (unsigned int) myNodes.size());
     }
 
     void selfDisplay(std::ostream & out) const;
@@ -594,8 +592,8 @@ namespace DGtal
     /**
      * @class Node
      *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
+     * An internal class that corresponds to a leaf of the tree, a pair
+     * (key, value). The nodes are stored contiguously in myNodes.
      */
     class Node
     {
@@ -608,64 +606,85 @@ namespace DGtal
        * @param key     key in the hashtree
        */
       Node(Value aValue, HashKey key)
-      {
-        myData = aValue;
-        myKey = key;
-      }
-
-      /**
-       * @return the next pair (aValue, key) in the list.
-       */
-      inline Node* getNext()
-      {
-        return myNext;
-      }
-
+        : myKey( key ), myData( aValue )
+      {}
 
       /**
-       * Insert the pair (value,key)  @a next in the node list
        *
-       * @param next a pointer to a pair (value,key) (Node).
+       * @return the key associated to a Node.
        */
-      inline void setNext(Node* next)
+      inline HashKey getKey() const
       {
-        myNext = next;
+        return myKey;
       }
 
       /**
        *
-       * @return the key associated to a Node.
+       * @return the object (aValue) associated to a Node.
        */
-      inline HashKey getKey()
+      inline Value& getObject()
       {
-        return myKey;
+        return myData;
       }
 
       /**
        *
        * @return the object (aValue) associated to a Node.
        */
-      inline Value& getObject()
+      inline const Value& getObject() const
       {
         return myData;
       }
-      ~Node() { }
     protected:
       HashKey myKey;
-      Node* myNext;
       Value myData;
     };// -----------------------------------------------------------
 
+    /// Index of an empty slot of the hash table, or of no node.
+    BOOST_STATIC_CONSTANT( unsigned int, EMPTY_SLOT = ~0u );
 
     /**
-     * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
+     * This is the hash function: it gives the home slot of a key in
+     * the hash table (multiplicative hashing, so that the keys of
+     * neighboring nodes are spread over the table).
      *
      * @param key a node in the hashtree.
      */
-    inline HashKey getIntermediateKey(const HashKey key) const;
+    inline unsigned int getIntermediateKey(const HashKey key) const;
+
+    /**
+     * @param key a node in the hashtree.
+     * @return the slot of the hash table containing the index of the
+     * node of key @a key, or the empty slot where it would be
+     * inserted.
+     */
+    inline unsigned int findSlot(const HashKey key) const
+    {
+      unsigned int slot = getIntermediateKey( key );
+      while ( ( mySlots[ slot ] != EMPTY_SLOT )
+              && ( myNodes[ mySlots[ slot ] ].getKey() != key ) )
+        slot = ( slot + 1 ) & mySlotMask;
+      return slot;
+    }
+
+    /**
+     * @param key a node in the hashtree.
+     * @return the index in myNodes of the node of key @a key, or
+     * EMPTY_SLOT if it does not exist.
+     */
+    inline unsigned int findNode(const HashKey key) const
+    {
+      return mySlots[ findSlot( key ) ];
+    }
 
+    /**
+     * Returns the index of the leaf containing a key of maximal depth,
+     * using and updating the cache of the last leaf found.
+     *
+     * @param key a key of maximal depth (@a key >= myDepthMask).
+     * @return the index in myNodes of the leaf.
+     */
+    unsigned int findLeaf(const HashKey key) const;
 
     /**
      * Add a Node to the tree.  This method is very used when writing
@@ -674,23 +693,24 @@ namespace DGtal
      *
      * @param object a object (value)
      * @param key a hashtree key
-     * @return a pointer to the node list.
+     * @return a pointer to the node.
      */
-    Node* addNode(const Value object, const HashKey key)
-    {
-      Node* n = getNode(key);
-      if (n)
-        {
-          n->getObject() = object;
-          //n->setObject(object);
-          return n;
-        }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
-    }
+    Node* addNode(const Value object, const HashKey key);
+
+    /**
+     * Resizes the hash table to 2^@a nbBits slots and inserts all the
+     * nodes of myNodes.
+     *
+     * @param nbBits the log2 of the number of slots.
+     */
+    void rehash(unsigned int nbBits);
+
+    /**
+     * Removes all the nodes, and sets the root to @a defaultValue.
+     *
+     * @param defaultValue the value of the root.
+     */
+    void resetNodes(const Value defaultValue);
 
   public:
     /**
@@ -700,16 +720,22 @@ namespace DGtal
      * @param key The key.
      * @return the pointer to the node corresponding to the key.
      */
-    inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
+    inline const Node* getNode(const HashKey key) const  // very used !! // public because Display2DFactory !!!
+    {
+      const unsigned int n = findNode( key );
+      return ( n == EMPTY_SLOT ) ? 0 : &myNodes[ n ];
+    }
+
+    /**
+     * Returns a pointer to the node corresponding to the key. If it
+     * does'nt exist, returns 0.
+     * @param key The key.
+     * @return the pointer to the node corresponding to the key.
+     */
+    inline Node* getNode(const HashKey key)
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
-        {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
-        }
-      return 0;
+      const unsigned int n = findNode( key );
+      return ( n == EMPTY_SLOT ) ? 0 : &myNodes[ n ];
     }
   protected:
 
@@ -754,18 +780,31 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The leaves of the tree (arena of nodes).
+     */
+    std::vector<Node> myNodes;
+
+    /**
+     * The open-addressing hash table: each slot is the index in
+     * myNodes of a node, or EMPTY_SLOT. Its size is a power of two
+     * and its load factor is at most 1/2.
      */
-    Node** myData;
+    std::vector<unsigned int> mySlots;
 
     /**
-     * The size of the intermediate hashkey. The bigger the less
-     * collisions, but at the same time the more chances to have
-     * unused memory allocated.
+     * The log2 of the initial size of the hash table.
      */
     unsigned int myKeySize;
 
-    unsigned int myArraySize;
+    /**
+     * The number of bits of the slot indices (log2 of mySlots.size()).
+     */
+    unsigned int mySlotBits;
+
+    /**
+     * mySlots.size() - 1.
+     */
+    unsigned int mySlotMask;
 
     /**
      * The depth of the tree
@@ -787,7 +826,16 @@ namespace DGtal
      * Precoputed masks to avoid recalculating it all the time
      */
     HashKey myDepthMask;
-    HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
+
+    /**
+     * Cache of the last leaf found by findLeaf: its key, the number of
+     * bits to shift a key of maximal depth to get its ancestor at the
+     * depth of the leaf (or a value greater than the key size if the
+     * cache is empty), and its index in myNodes.
+     */
+    mutable HashKey myCachedLeafKey;
+    mutable unsigned int myCachedLeafShift;
+    mutable unsigned int myCachedLeafNode;
 
   public:
     ///The morton code computer.
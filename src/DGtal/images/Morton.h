@@ -67,6 +67,11 @@ namespace DGtal
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
    *
+   * Bits are interleaved with a logarithmic number of shifts and
+   * masks per coordinate (dilate and contract), the masks being
+   * precomputed at construction. Each coordinate uses the
+   * (sizeof(HashKey)*8)/dimension lowest bits of the key.
+   *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
    * @tparam TPoint type of points. 
@@ -100,6 +105,24 @@ namespace DGtal
      */ 
     void interleaveBits(const Point  & aPoint, HashKey & output) const;
 
+    /**
+     * Spreads the (sizeof(HashKey)*8)/dimension lowest bits of a value:
+     * its i-th bit becomes the (i*dimension)-th bit of the result.
+     *
+     * @param value any value.
+     * @return the dilated value.
+     */
+    HashKey dilate(HashKey value) const;
+
+    /**
+     * Inverse of dilate: gathers the bits of @a key at positions
+     * multiple of dimension, other bits are ignored.
+     *
+     * @param key any key.
+     * @return the contracted value.
+     */
+    HashKey contract(HashKey key) const;
+
 
     /**
      * Returns the key corresponding to the coordinates passed in the parameters.
@@ -149,10 +172,13 @@ namespace DGtal
     void childrenKeys(const HashKey key, HashKey* result ) const;
     
   private: 
-    
-    ///@todo Implements dilateMasks
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
+
+    /// Number of bits of each coordinate in a key.
+    unsigned int myNbBits;
+    /// Number of steps to dilate a value (log2 of myNbBits, rounded up).
+    unsigned int myNbSteps;
+    /// myDilateMasks[k] keeps the bits of the values dilated by blocks of 2^k bits.
+    boost::array< HashKey, LOG2<sizeof(HashKey)*8>::VALUE + 2 > myDilateMasks;
   };
 } // namespace DGtal
 
@@ -350,6 +350,14 @@ template <typename Colormap, typename Image>
                           const Image & i,
                           const typename Image::Value & minV,
                           const typename Image::Value & maxV );
+
+// Same as drawImage, but the image is drawn as a single raster
+// embedded in the output file instead of one rectangle per pixel.
+template <typename Colormap, typename Image>
+  static void drawImageAsRaster( DGtal::Board2D & board,
+                                 const Image & i,
+                                 const typename Image::Value & minV,
+                                 const typename Image::Value & maxV );
 // ImageContainerBySTLVector, ImageContainerByHashTree, Image and ImageAdapter...
     
     
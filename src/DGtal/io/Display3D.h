@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/io/PrimitiveStore3D.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/shapes/Mesh.h"
@@ -472,6 +473,8 @@ namespace DGtal
      * Delete the cube list identified by a its name.
      * @param[in] name the name of the cube list.
      * @return true if the list was found and removed.
+     * The cubes of the primitive store with this name are removed as
+     * well, its squares are kept.
      *
      **/
     bool deleteCubeList(const DGtal::int32_t name);
@@ -488,6 +491,8 @@ namespace DGtal
      * Delete the quad list identified by a its name.
      * @param[in] name the name of the quad list.
      * @return true if the list was found and removed.
+     * The quads of the primitive store with this name are removed as
+     * well, its cubes are kept.
      *
      **/
     bool deleteQuadList(const DGtal::int32_t name);
@@ -625,6 +630,40 @@ namespace DGtal
      */
     void addCube(const RealPoint &center, double width=1.0);
 
+    /**
+     * Adds a range of voxels, as cubes centered on the embedding of
+     * digital points, with the current fill color and name. The
+     * cubes are stored in the compact primitive store (see
+     * primitiveStore()), which is meant for large digital sets.
+     *
+     * @tparam TPointIterator a model of forward iterator on Point.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     * @param width the cubes width.
+     */
+    template <typename TPointIterator>
+    void addCubes(TPointIterator itb, TPointIterator ite, double width=1.0);
+
+    /**
+     * Adds a range of surfels, as unit squares centered on the
+     * embedding of signed 2-cells, with the current fill color and
+     * name. The squares are stored in the compact primitive store
+     * (see primitiveStore()), which is meant for large digital
+     * surfaces.
+     *
+     * @tparam TSCellIterator a model of forward iterator on KSpace::SCell.
+     * @param itb an iterator on the first surfel.
+     * @param ite an iterator after the last surfel.
+     */
+    template <typename TSCellIterator>
+    void addSurfels(TSCellIterator itb, TSCellIterator ite);
+
+    /**
+     * @return the compact store of the primitives added by addCubes
+     * and addSurfels.
+     */
+    const PrimitiveStore3D & primitiveStore() const;
+
 
     /**
      * Method to add a point to the current display.
@@ -856,6 +895,10 @@ namespace DGtal
     /// integer identifier (OpenGL name)
     CubesMap myCubesMap;
 
+    /// Represents the cubes and surfels added in bulk (addCubes,
+    /// addSurfels), one float center and one palette index each.
+    PrimitiveStore3D myPrimitiveStore;
+
 
     /// names of the lists in myCubeSetList
     ///
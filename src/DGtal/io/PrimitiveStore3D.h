@@ -0,0 +1,325 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PrimitiveStore3D.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PrimitiveStore3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PrimitiveStore3D_RECURSES)
+#error Recursive header files inclusion detected in PrimitiveStore3D.h
+#else // defined(PrimitiveStore3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PrimitiveStore3D_RECURSES
+
+#if !defined PrimitiveStore3D_h
+/** Prevents repeated inclusion of headers. */
+#define PrimitiveStore3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class PrimitiveStore3D
+  /**
+   * Description of class 'PrimitiveStore3D' <p>
+   * \brief Aim: Compact storage of the voxels and surfels of a
+   * Display3D, for scenes of millions of primitives.
+   *
+   * Each primitive is an instance of a shared unit geometry (a cube,
+   * or a square orthogonal to one axis) and only stores its center,
+   * as three floats, its shape and the index of its color in a
+   * palette: 17 bytes instead of the 50 to 100 bytes of a CubeD3D or a
+   * QuadD3D. Primitives are stored as a structure of arrays, grouped
+   * in runs of consecutive primitives sharing a list name and a width
+   * (the scale of the unit geometry), so that exporters can process
+   * them list by list without any copy.
+   *
+   * Appending to the last run is amortized O(1), and the palette
+   * lookup is skipped while the color does not change, which is the
+   * case of bulk insertions (see Display3D::addCubes and
+   * Display3D::addSurfels).
+   *
+   * @code
+   * const PrimitiveStore3D& store = viewer.primitiveStore();
+   * for ( std::size_t i = 0; i < store.size(); ++i )
+   *   {
+   *     const float* center = store.position( i );
+   *     const PrimitiveStore3D::Shape shape = store.shape( i );
+   *     for ( unsigned int k = 0; k < PrimitiveStore3D::nbVertices( shape ); ++k )
+   *       ... center[ j ] + width * PrimitiveStore3D::vertex( shape, k )[ j ] ...
+   *   }
+   * @endcode
+   *
+   * @see Display3D, testPrimitiveStore3D.cpp
+   */
+  class PrimitiveStore3D
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+
+    /// Index of a color in the palette.
+    typedef DGtal::uint32_t ColorIndex;
+
+    /// Shared geometries of the primitives.
+    enum Shape { CUBE = 0, QUAD_X = 1, QUAD_Y = 2, QUAD_Z = 3 };
+
+    /// A run of consecutive primitives with the same name and width.
+    struct List
+    {
+      /// List identifier (OpenGL name).
+      DGtal::int32_t name;
+      /// Scale of the unit geometry (cube width or square side).
+      float width;
+      /// Index of the first primitive.
+      std::size_t begin;
+      /// Index after the last primitive.
+      std::size_t end;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The store is empty.
+     */
+    PrimitiveStore3D();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Reserves memory for a number of primitives.
+     * @param n the total number of primitives expected.
+     */
+    void reserve( const std::size_t n );
+
+    /**
+     * Appends a primitive, to the last run if it has the same name
+     * and width, to a new run otherwise.
+     * @param name the list identifier.
+     * @param width the scale of the unit geometry.
+     * @param x the first coordinate of the center.
+     * @param y the second coordinate of the center.
+     * @param z the third coordinate of the center.
+     * @param shape the geometry.
+     * @param color the color.
+     */
+    void add( const DGtal::int32_t name, const double width,
+              const double x, const double y, const double z,
+              const Shape shape, const Color & color );
+
+    /**
+     * @return the number of primitives.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return 'true' if there is no primitive.
+     */
+    bool empty() const;
+
+    /**
+     * @return the runs of primitives, in insertion order.
+     */
+    const std::vector<List> & lists() const;
+
+    /**
+     * @param i the index of a primitive.
+     * @return a pointer to the three coordinates of its center.
+     */
+    const float* position( const std::size_t i ) const;
+
+    /**
+     * @param i the index of a primitive.
+     * @return its shape.
+     */
+    Shape shape( const std::size_t i ) const;
+
+    /**
+     * @param i the index of a primitive.
+     * @return the index of its color in the palette.
+     */
+    ColorIndex colorIndex( const std::size_t i ) const;
+
+    /**
+     * @param i the index of a primitive.
+     * @return its color.
+     */
+    const Color & color( const std::size_t i ) const;
+
+    /**
+     * @return the colors used by the primitives.
+     */
+    const std::vector<Color> & palette() const;
+
+    /**
+     * @param name a list identifier.
+     * @return 'true' if a run has this name.
+     */
+    bool contains( const DGtal::int32_t name ) const;
+
+    /**
+     * Removes the primitives of a list, in linear time.
+     * @param name a list identifier.
+     * @return 'true' if some primitives were removed.
+     */
+    bool erase( const DGtal::int32_t name );
+
+    /**
+     * Removes the cubes of a list, in linear time. The squares with
+     * the same name are kept.
+     * @param name a list identifier.
+     * @return 'true' if some primitives were removed.
+     */
+    bool eraseCubes( const DGtal::int32_t name );
+
+    /**
+     * Removes the squares of a list, in linear time. The cubes with
+     * the same name are kept.
+     * @param name a list identifier.
+     * @return 'true' if some primitives were removed.
+     */
+    bool eraseQuads( const DGtal::int32_t name );
+
+    /**
+     * Removes all the primitives and colors.
+     */
+    void clear();
+
+    /**
+     * @return the number of bytes allocated by the store.
+     */
+    std::size_t memory() const;
+
+    /**
+     * @param shape a shape.
+     * @return the number of vertices of its unit geometry.
+     */
+    static unsigned int nbVertices( const Shape shape );
+
+    /**
+     * @param shape a shape.
+     * @return the number of quad faces of its unit geometry.
+     */
+    static unsigned int nbFaces( const Shape shape );
+
+    /**
+     * @param shape a shape.
+     * @param k the index of a vertex, smaller than nbVertices(shape).
+     * @return the three coordinates of the vertex of the unit geometry,
+     * centered on the origin.
+     */
+    static const float* vertex( const Shape shape, const unsigned int k );
+
+    /**
+     * @param shape a shape.
+     * @param f the index of a face, smaller than nbFaces(shape).
+     * @return the four vertex indices of the face, counterclockwise
+     * seen from outside for the cube.
+     */
+    static const unsigned int* face( const Shape shape, const unsigned int f );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Centers of the primitives, three coordinates per primitive.
+    std::vector<float> myPositions;
+    /// Shapes of the primitives.
+    std::vector<unsigned char> myShapes;
+    /// Palette indices of the colors of the primitives.
+    std::vector<ColorIndex> myColors;
+    /// Runs of primitives.
+    std::vector<List> myLists;
+    /// Palette of colors.
+    std::vector<Color> myPalette;
+    /// Index of each color of the palette.
+    std::map<Color, ColorIndex> myPaletteIndex;
+    /// Index of the last color added.
+    ColorIndex myLastColor;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param color a color.
+     * @return its index in the palette, where it is added if needed.
+     */
+    ColorIndex paletteIndex( const Color & color );
+
+    /**
+     * Removes the primitives of a list whose shape lies in a range.
+     * @param name a list identifier.
+     * @param first the first shape to remove.
+     * @param last the last shape to remove.
+     * @return 'true' if some primitives were removed.
+     */
+    bool erase( const DGtal::int32_t name, const Shape first, const Shape last );
+
+  }; // end of class PrimitiveStore3D
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PrimitiveStore3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PrimitiveStore3D' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PrimitiveStore3D & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/PrimitiveStore3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PrimitiveStore3D_h
+
+#undef PrimitiveStore3D_RECURSES
+#endif // else defined(PrimitiveStore3D_RECURSES)
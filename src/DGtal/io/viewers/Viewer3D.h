@@ -1380,7 +1380,8 @@ namespace DGtal
      * Creates an OpenGL list of type GL_QUADS from a CubeD3D.  Only
      * one OpenGL list is created but each map compoment (CubeD3D
      * vector) are marked by its identifier through the OpenGl
-     * glPushName() function.
+     * glPushName() function. The list also contains the cubes and
+     * surfels of the primitive store (see Display3D::addCubes).
      * See @ref moduleQGLInteraction for more details.
      * @param[in] aCubeMap  a map of cube (CubesMap) associating a name to a vector of CubeD3D.
      * @param[in] idList the Id of the list (should be given by glGenLists).
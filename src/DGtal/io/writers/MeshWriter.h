@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <vector>
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
@@ -54,7 +55,7 @@ namespace DGtal
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF, OBJ and PLY).
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
@@ -119,6 +120,43 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh) throw(DGtal::IOException);
+
+    /** 
+     * Export a Mesh towards a PLY format, binary (little endian) by
+     * default. Vertex coordinates are written as floats, faces as
+     * lists of int (at most 255 vertices per face) and face colors as
+     * uchar (if exported). The binary data is written by blocks,
+     * without any intermediate string: open the stream in binary mode.
+     * 
+     * @param out the output stream of the exported PLY object.
+     * @param aMesh the Mesh object to be exported.
+     * @param binary true for binary PLY, false for ASCII PLY (default true).
+     * @param exportColor true to export the face colors if they are stored in the Mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh,
+                           bool binary=true, bool exportColor=true) throw(DGtal::IOException);
+
+  private:
+
+    /**
+     * Appends the @a nbBytes lowest bytes of @a bits to @a buffer, in
+     * little endian order whatever the host.
+     */
+    static void pushLittleEndian( std::vector<char> & buffer,
+                                  DGtal::uint64_t bits, unsigned int nbBytes );
+
+    /**
+     * Appends the float @a x to @a buffer, in little endian order.
+     */
+    static void pushFloat( std::vector<char> & buffer, float x );
+
+    /**
+     * Writes @a buffer to @a out when it holds more than @a minSize
+     * bytes (all the bytes if @a minSize is 0), and empties it.
+     */
+    static void flushBuffer( std::ostream & out, std::vector<char> & buffer,
+                             std::size_t minSize = 0 );
     
     
   };
@@ -130,7 +168,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
@@ -192,13 +192,15 @@ namespace DGtal
 
     /**
        Initialization from a statistic (min, max, samples, variance
-       can typically be used) and a given \a formula.
+       can typically be used) and a given \a formula. With less than
+       two samples, or samples all equal, there is a single bin.
     */
     void init( Formula formula, const Statistic<Quantity> & stat );
 
     /**
        Initialization from a number of bins and a statistic (min, max, samples, variance
-       can typically be used).
+       can typically be used). With less than two samples, or samples
+       all equal, there is a single bin.
     */
     void init( Bin nbBins, const Statistic<Quantity> & stat );
 
@@ -217,6 +219,38 @@ namespace DGtal
     template <typename TInputIterator>
     void addValues( TInputIterator it, TInputIterator itE );
 
+    /**
+       Add the quantities stored in range [it,itE) to the histogram,
+       by \a nbChunks consecutive chunks. The bin counts of each chunk
+       are computed on their own, in parallel if OpenMP is available,
+       then added to the histogram. It may be used on the values of
+       an image, or on the quantities of a FlatEstimatorCache. The
+       binner must support concurrent calls (RegularBinner does).
+
+       @note Each chunk uses size() counters, so that \a nbChunks
+       should remain small (e.g. the number of threads) for
+       histograms with many bins.
+
+       @tparam TRandomAccessIterator any model of random access iterator on Quantity.
+       @param it an iterator on the first element of the range [it,itE)
+       @param itE an iterator after the last element of the range [it,itE)
+       @param nbChunks the number of chunks (1: as addValues( it, itE )).
+    */
+    template <typename TRandomAccessIterator>
+    void addValues( TRandomAccessIterator it, TRandomAccessIterator itE,
+                    unsigned int nbChunks );
+
+    /**
+       Adds the bin counts of another histogram with the same bins
+       (e.g. filled by another thread), as if its quantities had been
+       added to this object. terminate() must be called again
+       afterwards.
+
+       @param other a histogram with the same number of bins, and
+       initialized with the same binner.
+    */
+    void merge( const Histogram & other );
+
     /**
        Should be called when all values have been added.
     */
@@ -316,6 +350,15 @@ namespace DGtal
     */
     void prepare( Bin size );
 
+    /**
+       Initializes a single bin when \a stat has less than two
+       samples or no spread, which the binner and the formulas cannot
+       handle.
+       @param stat the statistic given to init.
+       @return 'true' if the single bin was initialized.
+    */
+    bool initSingleBin( const Statistic<Quantity> & stat );
+
 
   }; // end of class Histogram
 
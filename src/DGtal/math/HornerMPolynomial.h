@@ -0,0 +1,245 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HornerMPolynomial.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HornerMPolynomial.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HornerMPolynomial_RECURSES)
+#error Recursive header files inclusion detected in HornerMPolynomial.h
+#else // defined(HornerMPolynomial_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HornerMPolynomial_RECURSES
+
+#if !defined HornerMPolynomial_h
+/** Prevents repeated inclusion of headers. */
+#define HornerMPolynomial_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /// Recursive helpers for flattening and evaluating polynomials
+  /// (internal to HornerMPolynomial).
+  namespace detail
+  {
+    template < int k, typename TRing >
+    struct HornerMPolynomialProgram;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HornerMPolynomial
+  /**
+   * Description of template class 'HornerMPolynomial' <p>
+   * \brief Aim: Represents a multivariate polynomial "compiled" into a
+   * flat Horner scheme, for fast repeated evaluation.
+   *
+   * MPolynomial evaluation goes through MPolynomialEvaluator, which
+   * creates intermediate polynomials with less variables at each
+   * call. When a polynomial is fixed and evaluated many times (for
+   * instance by ImplicitPolynomial3Shape during digitization or
+   * surface tracking), it is much faster to convert it once into
+   * a flat program: a contiguous array of coefficients and an array of
+   * coefficient counts, both stored in depth-first order with highest
+   * degree first. Evaluation is then a nested Horner scheme that
+   * never allocates.
+   *
+   * Evaluation of ranges of points is done by blocks of \ref BlockSize
+   * points, so that the innermost loops operate on several points at
+   * once and can be vectorized by the compiler. If DGtal has been
+   * built with OpenMP support (WITH_OPENMP flag set to "true"), the
+   * evaluation of a vector of points is done in parallel.
+   *
+   * @code
+   * MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + ...;
+   * HornerMPolynomial<3, double> H( P );
+   * double v = H( RealPoint( 0.5, 1.0, 2.0 ) ); // same as P(0.5)(1.0)(2.0)
+   * @endcode
+   *
+   * @tparam n the number of variables (n >= 1).
+   * @tparam TRing the type of the coefficients and of the values
+   * (should be a model of CRing, typically double).
+   */
+  template < int n, typename TRing >
+  class HornerMPolynomial
+  {
+    BOOST_STATIC_ASSERT(( n >= 1 ));
+
+  public:
+    typedef HornerMPolynomial<n, TRing> Self;
+    typedef TRing Ring;
+    typedef std::vector<Ring> Coefficients;
+    typedef std::vector<unsigned int> Counts;
+    typedef typename Coefficients::size_type Size;
+
+    /// The number of points evaluated simultaneously in batch evaluation.
+    static const unsigned int BlockSize = 8;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The zero polynomial.
+    */
+    HornerMPolynomial();
+
+    /**
+       Constructor from an arbitrary polynomial.
+
+       @tparam TAlloc the allocator type of the polynomial.
+       @param poly any multivariate polynomial with n variables.
+    */
+    template < typename TAlloc >
+    HornerMPolynomial( const MPolynomial< n, Ring, TAlloc > & poly );
+
+    /**
+       Compiles the given polynomial. Any previous data is lost.
+
+       @tparam TAlloc the allocator type of the polynomial.
+       @param poly any multivariate polynomial with n variables.
+    */
+    template < typename TAlloc >
+    void init( const MPolynomial< n, Ring, TAlloc > & poly );
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       Evaluates the polynomial at the given point.
+
+       @tparam TPoint any type with a random access operator[]
+       returning values convertible to Ring (e.g. PointVector).
+       @param x any point with at least n coordinates.
+       @return the value P(x[0],...,x[n-1]).
+    */
+    template < typename TPoint >
+    Ring operator()( const TPoint & x ) const;
+
+    /**
+       Evaluates the polynomial at every point of the range
+       [itb,ite). Points are processed by blocks of BlockSize.
+
+       @tparam TPointIterator any model of input iterator on points.
+       @tparam TOutputIterator any model of output iterator on Ring.
+       @param itb an iterator on the first point.
+       @param ite an iterator after the last point.
+       @param out an output iterator where values are written.
+       @return the output iterator after the last written value.
+    */
+    template < typename TPointIterator, typename TOutputIterator >
+    TOutputIterator evaluate( TPointIterator itb, TPointIterator ite,
+                              TOutputIterator out ) const;
+
+    /**
+       Evaluates the polynomial at every point of \a points. If
+       DGtal is built with OpenMP, blocks of points are evaluated in
+       parallel.
+
+       @tparam TPoint any type with a random access operator[].
+       @param[in] points the points where the polynomial is evaluated.
+       @param[out] values the values at each point (resized to points.size()).
+    */
+    template < typename TPoint >
+    void evaluate( const std::vector<TPoint> & points,
+                   std::vector<Ring> & values ) const;
+
+    /**
+       @return the number of stored coefficients (including zero
+       coefficients between the leading one and the constant one).
+    */
+    Size size() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Coefficient counts of each sub-polynomial, in depth-first
+    /// order, highest degree first.
+    Counts myCounts;
+    /// Ring coefficients of the univariate polynomials in the last
+    /// variable, in depth-first order, highest degree first.
+    Coefficients myCoefficients;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       Evaluates the polynomial on a block of BlockSize points whose
+       coordinates are given variable by variable.
+
+       @param[in] x the coordinates, x[i][l] is the i-th coordinate of
+       the l-th point of the block.
+       @param[out] r the BlockSize values.
+    */
+    void evaluateBlock( const Ring x[ n ][ BlockSize ],
+                        Ring r[ BlockSize ] ) const;
+
+  }; // end of class HornerMPolynomial
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HornerMPolynomial'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HornerMPolynomial' to write.
+   * @return the output stream after the writing.
+   */
+  template < int n, typename TRing >
+  std::ostream&
+  operator<< ( std::ostream & out, const HornerMPolynomial<n, TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/HornerMPolynomial.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HornerMPolynomial_h
+
+#undef HornerMPolynomial_RECURSES
+#endif // else defined(HornerMPolynomial_RECURSES)
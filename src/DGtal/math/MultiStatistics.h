@@ -233,6 +233,18 @@ public:
     template <class Iter>
     void addValues(const  unsigned int k, Iter b, Iter e );
 
+    /**
+     * Merges into self the samples of another object with the same
+     * number of variables (e.g. filled by another thread), as if
+     * its values had been added to self after the current ones. The
+     * indices of the extremal values follow this order. Stored
+     * samples are appended if both objects store them. Neither object
+     * must be terminated.
+     *
+     * @param[in] other the object to merge.
+     */
+    void merge( const MultiStatistics & other );
+
     /** 
      * Once all sample values have been added to this object, computes
      * meaningful statistics like sample mean, variance and unbiased
@@ -355,10 +367,10 @@ private:
     double* myExp;
 
     /**
-     * For each variable, stores the sum of squared sample values for
-     * computing sample variance.
+     * For each variable, stores the sum of squared deviations to the
+     * sample mean, for computing sample variance.
      */
-    double* myExp2;
+    double* myM2;
 
     /**
      * For each variable, stores the sample variance.
@@ -246,6 +246,16 @@ namespace DGtal
      */
     void addStatistic( const unsigned int indexX, const Statistic<Value> & stat );
 
+    /**
+     * Merges into self the statistics of another profile with the
+     * same X values (e.g. filled by another thread), as if its
+     * values had been added to self.
+     *
+     * @param[in] other a valid profile with the same number of X values.
+     * @see Statistic::merge
+     */
+    void merge( const Profile & other );
+
 
 
     /**
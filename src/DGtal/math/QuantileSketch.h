@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file QuantileSketch.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module QuantileSketch.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(QuantileSketch_RECURSES)
+#error Recursive header files inclusion detected in QuantileSketch.h
+#else // defined(QuantileSketch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define QuantileSketch_RECURSES
+
+#if !defined QuantileSketch_h
+/** Prevents repeated inclusion of headers. */
+#define QuantileSketch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/concept_check.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class QuantileSketch
+  /**
+   * Description of template class 'QuantileSketch' <p>
+   * \brief Aim: Approximates the quantiles (median, quartiles, etc)
+   * of a set of sample values for one variable, without storing all
+   * the values. Sketches of disjoint sets of values can be merged,
+   * so that they may be filled in parallel.
+   *
+   * The sketch is a hierarchy of compactors, as in the KLL sketch
+   * of Karnin, Lang and Liberty (2016): level h holds values of
+   * weight 2^h. When a level is full, its values are sorted and one
+   * value out of two is promoted to the next level. The capacity of
+   * level h is k (2/3)^(H-1-h) (and at least 2), where H is the
+   * number of levels, so that the sketch holds about 3k values
+   * whatever the number n of samples. The rank error of a quantile
+   * is of order n/k. Unlike the KLL sketch, the kept values alternate
+   * deterministically between odd and even positions, so that the
+   * result only depends on the values and on the order of the
+   * insertions and merges.
+   *
+   * The minimum and the maximum are exact.
+   *
+   * @code
+   * QuantileSketch<double> sketch;
+   * sketch.addValues( values.begin(), values.end() );
+   * double median = sketch.median();
+   * double q9 = sketch.quantile( 0.9 );
+   * @endcode
+   *
+   * @tparam TQuantity the type of the values, a model of
+   * LessThanComparable.
+   *
+   * @see Statistic, testStatistics.cpp
+   */
+  template <typename TQuantity>
+  class QuantileSketch
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef TQuantity Quantity;
+    BOOST_CONCEPT_ASSERT(( boost::LessThanComparable<Quantity> ));
+    typedef QuantileSketch<Quantity> Self;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param k the accuracy parameter: the largest capacity of a
+     * level (at least 8, default 200).
+     */
+    QuantileSketch( unsigned int k = 200 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the accuracy parameter.
+     */
+    unsigned int k() const;
+
+    /**
+     * @return the number of samples.
+     */
+    DGtal::uint64_t samples() const;
+
+    /**
+     * @return the number of values held by the sketch.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return 'true' if no sample was added.
+     */
+    bool empty() const;
+
+    /**
+     * Adds a new sample value [v].
+     * @param v the new sample value.
+     */
+    void addValue( const Quantity & v );
+
+    /**
+     * Adds a sequence of sample values, scanning a container from
+     * iterators [b] to [e].
+     *
+     * @tparam Iter a model of input iterator on values.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     */
+    template <class Iter>
+    void addValues( Iter b, Iter e );
+
+    /**
+     * Adds a sequence of sample values, scanning a container from
+     * random access iterators [b] to [e] by \a nbChunks consecutive
+     * chunks. Each chunk is sketched on its own, in parallel if
+     * OpenMP is available, and the sketches are merged in chunk
+     * order: the result does not depend on the number of threads.
+     *
+     * @tparam RandomAccessIter a model of random access iterator on values.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     * @param nbChunks the number of chunks (1: as addValues( b, e )).
+     */
+    template <class RandomAccessIter>
+    void addValues( RandomAccessIter b, RandomAccessIter e, unsigned int nbChunks );
+
+    /**
+     * Merges into self the sketch of another set of samples of the
+     * same variable, as if its values had been added to self.
+     *
+     * @param other the sketch to merge, with the same accuracy parameter.
+     */
+    void merge( const QuantileSketch & other );
+
+    /**
+     * @return the smallest sample value (exact).
+     */
+    Quantity min() const;
+
+    /**
+     * @return the largest sample value (exact).
+     */
+    Quantity max() const;
+
+    /**
+     * @param q a number in [0,1].
+     * @return an approximation of the q-quantile: the smallest value
+     * whose approximate rank is at least q times the number of
+     * samples (the minimum for q=0, the maximum for q=1).
+     */
+    Quantity quantile( const double q ) const;
+
+    /**
+     * @return an approximation of the median value.
+     */
+    Quantity median() const;
+
+    /**
+     * @param v any value.
+     * @return an approximation of the fraction of samples that are
+     * less than or equal to v.
+     */
+    double cdf( const Quantity & v ) const;
+
+    /**
+     * Clears the object. As if it has just been created.
+     */
+    void clear();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The accuracy parameter.
+    unsigned int myK;
+    /// The number of samples.
+    DGtal::uint64_t mySamples;
+    /// The smallest sample value.
+    Quantity myMin;
+    /// The largest sample value.
+    Quantity myMax;
+    /// The values of each level, level h holding values of weight 2^h.
+    std::vector< std::vector<Quantity> > myLevels;
+    /// For each level, the parity of the next values kept by a compaction.
+    std::vector<unsigned char> myParities;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param h a level.
+     * @return its capacity, given the current number of levels.
+     */
+    std::size_t capacity( const std::size_t h ) const;
+
+    /**
+     * Compacts the full levels, from the lowest one.
+     */
+    void compress();
+
+    /**
+     * Promotes one value out of two of level h to level h+1.
+     * @param h a level.
+     */
+    void compact( const std::size_t h );
+
+    /**
+     * @param[out] items the values held by the sketch, sorted, with
+     * their weights.
+     */
+    void weightedValues( std::vector< std::pair<Quantity, DGtal::uint64_t> > & items ) const;
+
+  }; // end of class QuantileSketch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'QuantileSketch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'QuantileSketch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TQuantity>
+  std::ostream&
+  operator<< ( std::ostream & out, const QuantileSketch<TQuantity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/QuantileSketch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined QuantileSketch_h
+
+#undef QuantileSketch_RECURSES
+#endif // else defined(QuantileSketch_RECURSES)
@@ -59,6 +59,14 @@ namespace DGtal
     efficiency. For multiple variables, sample storage and others,
     see Statistics class.
 
+    The variance is accumulated as a sum of squared deviations to the
+    running mean (Welford), and two statistics of disjoint sets of
+    samples can be merged with the pairwise formula of Chan et
+    al. This makes the class suitable for parallel accumulation:
+    each thread fills its own statistic, which are merged at the
+    end (see merge and the chunked addValues). For the quantiles of
+    large sets of samples, prefer a QuantileSketch to stored samples.
+
     Backported from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene). \cite Lachaud03b
     
     @see testStatistics.cpp
@@ -108,9 +116,22 @@ namespace DGtal
      *
      * @param other the object to add.
      * @return a reference on 'this'.
+     * @see merge
      */
     Statistic & operator+=( const Statistic & other );
 
+    /**
+     * Merges into self the statistics of another set of samples of
+     * the same variable, as if its values had been added to
+     * self. Means and variances are combined with the pairwise
+     * formula of Chan et al., which is numerically stable. Stored
+     * samples are appended if both objects store them, otherwise
+     * self stops storing samples.
+     *
+     * @param other the object to merge.
+     */
+    void merge( const Statistic & other );
+
     /**
      * Adds two set of statistics (should be of the same variable).
      *
@@ -200,6 +221,28 @@ namespace DGtal
     template <class Iter>
     void addValues( Iter b, Iter e );
 
+    /**
+     * Adds a sequence of sample values, scanning a container from
+     * random access iterators [b] to [e] by \a nbChunks consecutive
+     * chunks. Each chunk is accumulated in its own statistic, in
+     * parallel if OpenMP is available, and the statistics are merged
+     * in chunk order: the result does not depend on the number of
+     * threads. It may be used on the values of an image, or on the
+     * quantities of a FlatEstimatorCache.
+     *
+     * @code
+     Statistic<double> stats;
+     stats.addValues( cache.quantities().begin(), cache.quantities().end(), 16 );
+     @endcode
+     *
+     * @tparam RandomAccessIter a model of random access iterator on values.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     * @param nbChunks the number of chunks (1: as addValues( b, e )).
+     */
+    template <class RandomAccessIter>
+    void addValues( RandomAccessIter b, RandomAccessIter e, unsigned int nbChunks );
+
     /** 
      * Clears the object. As if it has just been created.
      */
@@ -251,10 +294,10 @@ namespace DGtal
     Quantity myExp;
 
     /**
-     * stores the sum of squared sample values for
+     * stores the sum of squared deviations to the sample mean, for
      * computing sample variance.
      */
-    Quantity myExp2;
+    double myM2;
 
     /**
      * stores the maximal sample value.
@@ -120,6 +120,13 @@ namespace DGtal
      */
     SimpleMatrix ( const Self & other );
 
+    /**
+     * Copy assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & other ) = default;
+
     // ----------------------- Standard services ------------------------------
 
     /**
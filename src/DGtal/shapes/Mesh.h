@@ -41,7 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <stdexcept>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/utility/enable_if.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/io/Color.h"
@@ -60,12 +66,21 @@ namespace DGtal
    * store any color information (it can be changed  by setting the default
    * constructor parameter saveFaceColor to 'true').
    *
-   * The mesh object stores explicitly each vertex and each face are
-   * represented with the list of point index.
+   * The mesh object stores explicitly each vertex. Faces are stored
+   * in two flat buffers (compressed sparse rows): the vertex indices of
+   * all faces one after the other, and the position of the first index
+   * of each face. A face is thus accessed through a view (FaceView or
+   * ConstFaceView) on the index buffer, and adding faces never
+   * allocates one block per face. Face colors are stored in a separate
+   * array, only if requested. Many faces can be added at once with
+   * addFaces.
    *
-   * @note This class is a preliminary version of a mesh strucuture
-   * (the method to access neigborhing facets or to a given facet are
-   * not yet given)
+   * Adjacency is given by half-edges, built on demand (or with
+   * computeHalfEdges): the half-edge \a h is the \a h-th index of the
+   * index buffer, it goes from the vertex of this index to the next
+   * vertex of its face. The table gives its face, its opposite
+   * half-edge and the outgoing half-edges of each vertex. It is
+   * rebuilt after any modification of the faces.
    *
    * This class was defined to import and display a mesh from different formats like OFF file format. 
    * Since it realized the concept of CDrawableWithDisplay3D we can display an Mesh with a Display3D object:
@@ -122,9 +137,10 @@ namespace DGtal
     typedef  std::vector<TPoint> VertexStorage; 
     
     /**
-     * Define the type to store the faces of the mesh. 
+     * Define the type of the flat buffers storing the faces of the
+     * mesh (see faceStarts and faceIndices).
      **/
-    typedef  std::vector<MeshFace> FaceStorage; 
+    typedef  std::vector<unsigned int> IndexStorage; 
 
     /**
      * Define the type to store the color associated to each face
@@ -142,6 +158,150 @@ namespace DGtal
      **/
     typedef typename VertexStorage::iterator Iterator;
 
+    /**
+     * A view on consecutive indices of the index buffer of the mesh,
+     * e.g. the vertex indices of a face. It behaves like a (fixed size)
+     * MeshFace and is converted to a MeshFace if needed. It is
+     * invalidated when faces are added or removed.
+     *
+     * @tparam TIndex either 'unsigned int' or 'const unsigned int'.
+     **/
+    template <typename TIndex>
+    class IndexView
+    {
+    public:
+      typedef TIndex * iterator;
+      typedef const unsigned int * const_iterator;
+      typedef unsigned int value_type;
+      typedef unsigned int size_type;
+
+      /**
+       * Constructor.
+       * @param begin a pointer to the first index.
+       * @param size the number of indices.
+       **/
+      IndexView( TIndex * begin = 0, unsigned int size = 0 )
+        : myBegin( begin ), mySize( size ) {}
+      /**
+       * Conversion from a read-write view to a read-only one (views
+       * are otherwise copied and assigned by the implicit members).
+       * @param other the view to convert.
+       **/
+      template <typename TOtherIndex>
+      IndexView( const IndexView<TOtherIndex> & other,
+                 typename boost::enable_if< boost::is_convertible<TOtherIndex*, TIndex*> >::type* = 0 )
+        : myBegin( other.begin() ), mySize( other.size() ) {}
+      /// @return the number of indices.
+      unsigned int size() const { return mySize; }
+      /// @return 'true' if there is no index.
+      bool empty() const { return mySize == 0; }
+      /// @return the index at position @a i.
+      /// @param i any position smaller than size().
+      TIndex & operator[]( unsigned int i ) const { return myBegin[ i ]; }
+      /// @return the index at position @a i, or throws std::out_of_range.
+      /// @param i any position.
+      TIndex & at( unsigned int i ) const
+      {
+        if ( i >= mySize ) throw std::out_of_range( "Mesh::IndexView::at" );
+        return myBegin[ i ];
+      }
+      /// @return a pointer to the first index.
+      TIndex * begin() const { return myBegin; }
+      /// @return a pointer after the last index.
+      TIndex * end() const { return myBegin + mySize; }
+      /// @return a copy of the indices.
+      operator MeshFace() const { return MeshFace( myBegin, myBegin + mySize ); }
+
+    private:
+      TIndex * myBegin;
+      unsigned int mySize;
+    };
+
+    /**
+     * Read-only view on the vertex indices of a face.
+     **/
+    typedef IndexView<const unsigned int> ConstFaceView;
+
+    /**
+     * Read-write view on the vertex indices of a face.
+     **/
+    typedef IndexView<unsigned int> FaceView;
+
+    /**
+     * Random access iterator on the faces of a mesh, whose value is a
+     * view on the face.
+     *
+     * @tparam TMesh either 'Mesh' or 'const Mesh'.
+     * @tparam TView either FaceView or ConstFaceView.
+     **/
+    template <typename TMesh, typename TView>
+    class FaceIteratorBase
+      : public boost::iterator_facade< FaceIteratorBase<TMesh, TView>, TView,
+                                       boost::random_access_traversal_tag, TView >
+    {
+    public:
+      /**
+       * Constructor.
+       * @param mesh the mesh (or 0 for a singular iterator).
+       * @param face the index of the pointed face.
+       **/
+      FaceIteratorBase( TMesh * mesh = 0, unsigned int face = 0 )
+        : myMesh( mesh ), myFace( face ) {}
+
+      /**
+       * Conversion from an iterator to a const iterator.
+       * @param other the iterator to convert.
+       **/
+      template <typename TOtherMesh, typename TOtherView>
+      FaceIteratorBase( const FaceIteratorBase<TOtherMesh, TOtherView> & other,
+                        typename boost::enable_if< boost::is_convertible<TOtherMesh*, TMesh*> >::type* = 0 )
+        : myMesh( other.myMesh ), myFace( other.myFace ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+      template <typename TOtherMesh, typename TOtherView> friend class FaceIteratorBase;
+      static ConstFaceView face( const Mesh * mesh, unsigned int f ) { return mesh->getFace( f ); }
+      static FaceView face( Mesh * mesh, unsigned int f ) { return mesh->modifyFace( f ); }
+      TView dereference() const { return face( myMesh, myFace ); }
+      template <typename TOtherMesh, typename TOtherView>
+      bool equal( const FaceIteratorBase<TOtherMesh, TOtherView> & other ) const
+      { return myFace == other.myFace; }
+      void increment() { ++myFace; }
+      void decrement() { --myFace; }
+      void advance( std::ptrdiff_t n ) { myFace = (unsigned int) ( myFace + n ); }
+      template <typename TOtherMesh, typename TOtherView>
+      std::ptrdiff_t distance_to( const FaceIteratorBase<TOtherMesh, TOtherView> & other ) const
+      { return (std::ptrdiff_t) other.myFace - (std::ptrdiff_t) myFace; }
+
+      TMesh * myMesh;
+      unsigned int myFace;
+    };
+
+    /**
+     * Define the type of the const iterator on faces.
+     **/
+    typedef FaceIteratorBase<const Mesh, ConstFaceView> FaceConstIterator;
+
+    /**
+     * Define the type of the iterator on faces. Dereferencing it gives
+     * a modifiable view (see modifyFace).
+     **/
+    typedef FaceIteratorBase<Mesh, FaceView> FaceIterator;
+
+    /**
+     * Former type of the face storage, only kept so that
+     * 'FaceStorage::const_iterator' and 'FaceStorage::iterator' still
+     * name the types returned by faceBegin() and faceEnd().
+     *
+     * @deprecated use FaceConstIterator and FaceIterator instead.
+     **/
+    struct FaceStorage
+    {
+      typedef MeshFace value_type;
+      typedef FaceConstIterator const_iterator;
+      typedef FaceIterator iterator;
+    };
+
     
 
 
@@ -211,6 +371,16 @@ namespace DGtal
      *
      **/
     void addVertex(const TPoint &vertex);
+
+    /**
+     * Reserves memory for the vertices and faces to come.
+     *
+     * @param[in] nbVertices the expected total number of vertices.
+     * @param[in] nbFaces the expected total number of faces.
+     * @param[in] nbIndices the expected total number of vertex indices
+     * of all faces.
+     **/
+    void reserve(unsigned int nbVertices, unsigned int nbFaces, unsigned int nbIndices);
       
     
   
@@ -257,6 +427,22 @@ namespace DGtal
     * 
     **/    
     void addFace(const MeshFace &aFace, const DGtal::Color &aColor=DGtal::Color::White);
+
+
+    /**
+     * Add many faces at once, given as flat buffers: the number of
+     * vertices of each face, and the vertex indices of all the faces
+     * one after the other. The index buffer of the mesh grows once.
+     *
+     * @param[in] faceSizes the number of vertices of each face.
+     * @param[in] indices the vertex indices of the faces (as many as
+     * the sum of @a faceSizes).
+     * @param[in] colors either empty (faces are white) or the color of
+     * each face. Colors are only kept if isStoringFaceColors().
+     **/
+    void addFaces(const std::vector<unsigned int> &faceSizes,
+                  const std::vector<unsigned int> &indices,
+                  const std::vector<DGtal::Color> &colors = std::vector<DGtal::Color>());
     
 
     /**
@@ -284,9 +470,9 @@ namespace DGtal
     
     /**
      * @param i the index of the face.
-     * @return a const reference to the face of index i. 
+     * @return a read-only view on the face of index i. 
      **/
-    const MeshFace & getFace(unsigned int i) const;
+    ConstFaceView getFace(unsigned int i) const;
 
 
     /**
@@ -299,9 +485,34 @@ namespace DGtal
     
     /**
      * @param i the index of the face.
-     * @return a const reference to the face of index i. 
+     * @return a view on the face of index i, whose vertex indices can
+     * be modified. The half-edges are rebuilt by the next adjacency
+     * query, so prefer getFace for read-only accesses.
+     **/
+    FaceView modifyFace(unsigned int i);
+
+    /**
+     * @param i the index of the face.
+     * @return a view on the face of index i, whose vertex indices can
+     * be modified (as modifyFace).
+     *
+     * @deprecated use modifyFace to modify a face, and getFace on a
+     * const mesh to read it: this one rebuilds the half-edges at the
+     * next adjacency query.
+     **/
+    FaceView getFace(unsigned int i);
+
+    /**
+     * @return the position in faceIndices() of the first index of each
+     * face, followed by the number of indices (size nbFaces()+1).
      **/
-    MeshFace & getFace(unsigned int i);
+    const IndexStorage & faceStarts() const;
+
+    /**
+     * @return the vertex indices of all the faces, one face after the
+     * other.
+     **/
+    const IndexStorage & faceIndices() const;
     
 
 
@@ -389,9 +600,9 @@ namespace DGtal
      *
      **/
     
-    FaceStorage::const_iterator 
+    FaceConstIterator 
     faceBegin() const {
-      return myFaceList.begin();
+      return FaceConstIterator( this, 0 );
     }
     
 
@@ -401,32 +612,33 @@ namespace DGtal
      *
      **/
     
-    FaceStorage::const_iterator 
+    FaceConstIterator 
     faceEnd() const {
-      return myFaceList.end();
+      return FaceConstIterator( this, nbFaces() );
     }    
     
 
     /**
-     * @return a const iterator pointing to the first face of the mesh.  
+     * @return an iterator pointing to the first face of the mesh, whose
+     * dereferencing gives modifiable views (see modifyFace).
      *
      **/
     
-    FaceStorage::iterator 
+    FaceIterator 
     faceBegin()  {
-      return myFaceList.begin();
+      return FaceIterator( this, 0 );
     }
     
 
 
     /**
-     * @return a const iterator pointing after the end of the last face of the mesh.
+     * @return an iterator pointing after the end of the last face of the mesh.
      *
      **/
     
-    FaceStorage::iterator 
+    FaceIterator 
     faceEnd()  {
-      return myFaceList.end();
+      return FaceIterator( this, nbFaces() );
     }    
     
     
@@ -475,6 +687,90 @@ namespace DGtal
      **/
     unsigned int quadToTriangularFaces();
         
+    // ----------------------- Half-edges ------------------------------------
+  public:
+
+    /**
+     * @return the index returned for a missing half-edge (e.g. the
+     * opposite of a boundary half-edge).
+     **/
+    static unsigned int invalidIndex();
+
+    /**
+     * Builds the half-edge table if it is not up to date. It is
+     * otherwise built by the first call to a half-edge service.
+     * Concurrent calls on a mesh that is not modified meanwhile are
+     * safe: the table is built once, under a lock.
+     **/
+    void computeHalfEdges() const;
+
+    /**
+     * @return the number of half-edges, i.e. the number of vertex
+     * indices of all faces.
+     **/
+    unsigned int nbHalfEdges() const;
+
+    /**
+     * @param h any half-edge.
+     * @return the face of @a h.
+     **/
+    unsigned int halfEdgeFace(unsigned int h) const;
+
+    /**
+     * @param h any half-edge.
+     * @return the vertex from which @a h goes.
+     **/
+    unsigned int halfEdgeSource(unsigned int h) const;
+
+    /**
+     * @param h any half-edge.
+     * @return the vertex to which @a h goes.
+     **/
+    unsigned int halfEdgeTarget(unsigned int h) const;
+
+    /**
+     * @param h any half-edge.
+     * @return the next half-edge of the face of @a h.
+     **/
+    unsigned int nextHalfEdge(unsigned int h) const;
+
+    /**
+     * @param h any half-edge.
+     * @return the previous half-edge of the face of @a h.
+     **/
+    unsigned int previousHalfEdge(unsigned int h) const;
+
+    /**
+     * @param h any half-edge.
+     * @return the half-edge going the other way along the same edge,
+     * or invalidIndex() if the edge is on the boundary or is shared by
+     * more than two faces.
+     **/
+    unsigned int oppositeHalfEdge(unsigned int h) const;
+
+    /**
+     * @param v any vertex.
+     * @return a view on the half-edges whose source is @a v.
+     **/
+    IndexView<const unsigned int> outgoingHalfEdges(unsigned int v) const;
+
+    /**
+     * Outputs the vertices sharing an edge with a vertex, in increasing order.
+     * @param[in] v any vertex.
+     * @param[out] neighbors the neighboring vertices of @a v.
+     **/
+    void vertexNeighbors(unsigned int v, std::vector<unsigned int> &neighbors) const;
+
+    /**
+     * Outputs the faces sharing an edge with a face, in increasing order.
+     * @param[in] f any face.
+     * @param[out] neighbors the neighboring faces of @a f.
+     **/
+    void faceNeighbors(unsigned int f, std::vector<unsigned int> &neighbors) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -497,11 +793,27 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
-    FaceStorage  myFaceList;
+    /// The position in myFaceIndices of the first index of each face, and its size.
+    IndexStorage myFaceStarts;
+    /// The vertex indices of all faces.
+    IndexStorage myFaceIndices;
     VertexStorage myVertexList;    
     ColorStorage myFaceColorList;
     bool mySaveFaceColor;
     DGtal::Color myDefaultColor;
+
+    /// 'true' when the half-edge table below is up to date.
+    mutable std::atomic<bool> myHalfEdgesValid;
+    /// Serializes the builds of the half-edge table.
+    mutable std::mutex myHalfEdgesMutex;
+    /// The face of each half-edge.
+    mutable IndexStorage myHalfEdgeFaces;
+    /// The opposite of each half-edge, or invalidIndex().
+    mutable IndexStorage myOpposites;
+    /// The position in myOutgoing of the first half-edge of each vertex, and its size.
+    mutable IndexStorage myVertexStarts;
+    /// The half-edges sorted by source vertex.
+    mutable IndexStorage myOutgoing;
     
 
     
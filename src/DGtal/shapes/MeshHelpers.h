@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshHelpers.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MeshHelpers.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshHelpers_RECURSES)
+#error Recursive header files inclusion detected in MeshHelpers.h
+#else // defined(MeshHelpers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshHelpers_RECURSES
+
+#if !defined MeshHelpers_h
+/** Prevents repeated inclusion of headers. */
+#define MeshHelpers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/topology/DigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct MeshHelpers
+  /**
+     Description of struct 'MeshHelpers' <p>
+     \brief Aim: Static functions to build a Mesh directly from a 3D
+     DigitalSurface, without going through a Display3D.
+
+     - digitalSurface2PrimalMesh: each surfel is a quad whose vertices
+       are the pointels of the surfel. Pointels shared by several
+       surfels are welded into a single mesh vertex, in parallel, by
+       hashing their Khalimsky coordinates (see weldKeys).
+
+     - digitalSurface2DualMesh: each surfel is a vertex and each closed
+       face of the digital surface (an umbrella around a linel, see
+       DigitalSurface::computeIndexedFaces) is a mesh face, as in
+       marching-cubes like reconstructions.
+
+     Threads are used if DGtal has been built with OpenMP support
+     (WITH_OPENMP flag set to "true"). The resulting mesh does not
+     depend on the number of threads. It can then be written in OFF,
+     OBJ or PLY format with MeshWriter.
+
+     @code
+     typedef DigitalSurface< DigitalSetBoundary< KSpace, DigitalSet > > Surface;
+     Surface surface( new DigitalSetBoundary< KSpace, DigitalSet >( K, set ) );
+     Mesh<Z3i::RealPoint> mesh;
+     MeshHelpers::digitalSurface2PrimalMesh( surface, CanonicCellEmbedder<KSpace>( K ), mesh );
+     std::ofstream out( "surface.ply", std::ios::binary );
+     MeshWriter<Z3i::RealPoint>::export2PLY( out, mesh );
+     @endcode
+
+     @see testMeshHelpers.cpp
+  */
+  struct MeshHelpers
+  {
+    /**
+       Appends to @a mesh the primal quads of a 3D digital surface:
+       one quad per surfel, oriented consistently with the surfel (its
+       normal goes from the direct incident spel to the indirect one),
+       whose vertices are the shared pointels of the surface.
+
+       @tparam TDigitalSurfaceContainer any model of
+       CDigitalSurfaceContainer, in 3D.
+       @tparam TCellEmbedder any model of CCellEmbedder (e.g. CanonicCellEmbedder).
+
+       @param[in] surface the digital surface.
+       @param[in] embedder the embedding of the pointels.
+       @param[in,out] mesh the mesh where vertices and faces are appended.
+    */
+    template <typename TDigitalSurfaceContainer, typename TCellEmbedder>
+    static void digitalSurface2PrimalMesh
+    ( const DigitalSurface<TDigitalSurfaceContainer> & surface,
+      const TCellEmbedder & embedder,
+      Mesh<typename TCellEmbedder::Value> & mesh );
+
+    /**
+       Appends to @a mesh the dual faces of a 3D digital surface: one
+       vertex per surfel (in the order of IndexedFaces::vertices) and
+       one face per closed face of the surface, whose vertices follow
+       DigitalSurface::verticesAroundFace.
+
+       @tparam TDigitalSurfaceContainer any model of
+       CDigitalSurfaceContainer, in 3D.
+       @tparam TSCellEmbedder any model of CSCellEmbedder (e.g. CanonicSCellEmbedder).
+
+       @param[in] surface the digital surface.
+       @param[in] embedder the embedding of the surfels.
+       @param[in,out] mesh the mesh where vertices and faces are appended.
+    */
+    template <typename TDigitalSurfaceContainer, typename TSCellEmbedder>
+    static void digitalSurface2DualMesh
+    ( const DigitalSurface<TDigitalSurfaceContainer> & surface,
+      const TSCellEmbedder & embedder,
+      Mesh<typename TSCellEmbedder::Value> & mesh );
+
+    /**
+       Numbers the distinct values of @a keys, in parallel. Keys are
+       distributed into buckets by a hash function, and each bucket is
+       sorted independently. The numbering does not depend on the
+       number of threads.
+
+       @param[in] keys any keys.
+       @param[out] ids the number of each key, between 0 and the number
+       of distinct keys (size keys.size()).
+       @param[out] firsts for each number, the position in @a keys of
+       its first occurrence.
+       @return the number of distinct keys.
+    */
+    static std::size_t weldKeys( const std::vector<DGtal::uint64_t> & keys,
+                                 std::vector<std::size_t> & ids,
+                                 std::vector<std::size_t> & firsts );
+
+  }; // end of struct MeshHelpers
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/MeshHelpers.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshHelpers_h
+
+#undef MeshHelpers_RECURSES
+#endif // else defined(MeshHelpers_RECURSES)
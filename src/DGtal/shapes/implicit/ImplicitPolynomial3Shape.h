@@ -41,11 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/HornerMPolynomial.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +62,12 @@ namespace DGtal
    *
    * Model of CImplicitFunction
    *
+   * The polynomial and all the partial derivatives used by the
+   * services below are compiled once at initialization into
+   * HornerMPolynomial objects, so that evaluations do not allocate.
+   * Batch services (values(), gradients()) evaluate whole vectors of
+   * points at once, in parallel if DGtal is built with OpenMP.
+   *
    * @tparam TSpace the Digital space definition.
    */
 
@@ -75,6 +83,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef HornerMPolynomial< 3, Ring > HornerPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -137,6 +146,26 @@ namespace DGtal
     inline
     RealVector gradient( const RealPoint &aPoint ) const;
 
+    /**
+       Batch evaluation of the polynomial.
+
+       @param[in] points any points in the Euclidean space.
+       @param[out] values the value of the polynomial at each point
+       (resized to points.size()).
+    */
+    void values( const std::vector<RealPoint> & points,
+                 std::vector<Value> & values ) const;
+
+    /**
+       Batch evaluation of the gradient of the polynomial.
+
+       @param[in] points any points in the Euclidean space.
+       @param[out] gradients the gradient vector of the polynomial at
+       each point (resized to points.size()).
+    */
+    void gradients( const std::vector<RealPoint> & points,
+                    std::vector<RealVector> & gradients ) const;
+
 // ------------------------------------------------------------ Added by Anis Benyoub
 
     /**
@@ -244,6 +273,19 @@ namespace DGtal
     Polynomial3 myUpPolynome;
     Polynomial3 myLowPolynome;
 
+    // Compiled versions of the polynomials above, used for evaluation.
+    HornerPolynomial3 myHornerPolynomial;
+    HornerPolynomial3 myHornerFx;
+    HornerPolynomial3 myHornerFy;
+    HornerPolynomial3 myHornerFz;
+    HornerPolynomial3 myHornerFxx;
+    HornerPolynomial3 myHornerFxy;
+    HornerPolynomial3 myHornerFxz;
+    HornerPolynomial3 myHornerFyy;
+    HornerPolynomial3 myHornerFyz;
+    HornerPolynomial3 myHornerFzz;
+    HornerPolynomial3 myHornerUpPolynome;
+    HornerPolynomial3 myHornerLowPolynome;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -43,6 +43,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <algorithm>
 // JOL (2013/02/01): required to define internal tags (boost/graph/copy.hpp, l. 251 error ?).
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
@@ -287,6 +288,44 @@ namespace DGtal
     /// The set of faces is defined as set.
     typedef std::set<Face> FaceSet;
 
+    /**
+       Flat description of the faces of the digital surface, as
+       computed by computeIndexedFaces: vertices are numbered from 0,
+       and each face is a range of vertex indices in a single array
+       (compressed rows), which avoids recomputing umbrellas when the
+       faces are visited several times (mesh export, discrete
+       calculus).
+    */
+    struct IndexedFaces {
+      /// The vertices, sorted. A vertex index is a position in this range.
+      VertexRange vertices;
+      /// The faces, sorted.
+      FaceRange faces;
+      /// The vertices of face f are faceVertices[ faceStarts[ f ] ],
+      /// ..., faceVertices[ faceStarts[ f + 1 ] - 1 ] (size nbFaces()+1).
+      std::vector<Size> faceStarts;
+      /// The vertex indices of all faces, in the order of verticesAroundFace.
+      std::vector<Size> faceVertices;
+
+      /// @return the number of faces.
+      inline Size nbFaces() const
+      { return faces.size(); }
+      /// @return the number of vertices of face @a f.
+      inline Size nbVertices( Size f ) const
+      { return faceStarts[ f + 1 ] - faceStarts[ f ]; }
+      /**
+         @param v any vertex of the digital surface.
+         @return the index of @a v (O(log n)).
+      */
+      inline Size index( const Vertex & v ) const
+      {
+        typename VertexRange::const_iterator it
+          = std::lower_bound( vertices.begin(), vertices.end(), v );
+        ASSERT( ( it != vertices.end() ) && ( *it == v ) );
+        return it - vertices.begin();
+      }
+    };
+
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -538,6 +577,20 @@ namespace DGtal
     */
     FaceSet allOpenFaces() const;
 
+    /**
+       Computes the faces of the digital surface, in parallel when
+       DGtal is built with OpenMP, and their vertices as vertex indices
+       in flat arrays. Each face is computed only from the vertex of
+       its representative state (see Face), so that no face is found
+       twice.
+
+       @param[out] indexed the vertices and faces of the digital surface.
+       @param closed when 'true', closed faces are computed.
+       @param open when 'true', open faces are computed.
+    */
+    void computeIndexedFaces( IndexedFaces & indexed,
+                              bool closed = true, bool open = false ) const;
+
     /**
        @param state any valid state (i.e. some pivot cell) on the surface.
        @return the face that contains the given [state].
@@ -666,6 +719,41 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Computes a face with the given umbrella computer.
+       @param state any valid state on the surface.
+       @param umbrella an umbrella computer on this surface.
+       @return the face that contains the given [state].
+    */
+    Face computeFace( UmbrellaState state, Umbrella & umbrella ) const;
+
+    /**
+       Appends to @a faces the faces whose representative state lies on
+       @a v, each one once.
+
+       @param v any vertex.
+       @param tracker a tracker on this surface.
+       @param umbrella an umbrella computer on this surface.
+       @param closed when 'true', closed faces are appended.
+       @param open when 'true', open faces are appended.
+       @param[in,out] faces the faces.
+    */
+    void ownedFaces( const Vertex & v, DigitalSurfaceTracker & tracker,
+                     Umbrella & umbrella, bool closed, bool open,
+                     FaceRange & faces ) const;
+
+    /**
+       Computes the faces owned by @a vertices, in parallel when DGtal
+       is built with OpenMP.
+
+       @param vertices all the vertices of the surface.
+       @param closed when 'true', closed faces are computed.
+       @param open when 'true', open faces are computed.
+       @param[out] faces the sorted faces.
+    */
+    void collectFaces( const VertexRange & vertices, bool closed, bool open,
+                       FaceRange & faces ) const;
+
   }; // end of class DigitalSurface
 
 
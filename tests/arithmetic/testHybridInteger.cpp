@@ -0,0 +1,245 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHybridInteger.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class HybridInteger.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/HybridInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HybridInteger.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' iff @a h is valid and equal to @a b.
+bool same( const HybridInteger & h, const BigInteger & b )
+{
+  // Explicit int64 bounds, since long may have only 32 bits.
+  static const BigInteger lowest( "-9223372036854775808" );
+  static const BigInteger highest( "9223372036854775807" );
+  return h.isValid() && ( h.big() == b )
+    && ( h.isSmall() == ( ( lowest <= b ) && ( b <= highest ) ) );
+}
+
+/// Random 64 bits integer, of any magnitude.
+DGtal::int64_t random64()
+{
+  DGtal::uint64_t v = 0;
+  for ( int i = 0; i < 4; ++i )
+    v = ( v << 16 ) | (DGtal::uint64_t) ( rand() & 0xFFFF );
+  return (DGtal::int64_t) ( v >> ( rand() % 64 ) ) * ( ( rand() % 2 ) ? 1 : -1 );
+}
+
+/**
+ * Compares the operations on HybridInteger with the ones on
+ * BigInteger, for overflowing values and random values.
+ */
+bool testOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing HybridInteger operations against BigInteger" );
+  const DGtal::int64_t M = std::numeric_limits<DGtal::int64_t>::max();
+  const DGtal::int64_t m = std::numeric_limits<DGtal::int64_t>::min();
+  std::vector<HybridInteger> values;
+  const DGtal::int64_t edges[] = { 0, 1, -1, 2, -2, 3, M, M - 1, m, m + 1,
+                                   DGtal::int64_t( 1 ) << 32, -( DGtal::int64_t( 1 ) << 32 ),
+                                   DGtal::int64_t( 3037000499LL ), DGtal::int64_t( 3037000500LL ) };
+  for ( unsigned int i = 0; i < sizeof( edges ) / sizeof( DGtal::int64_t ); ++i )
+    values.push_back( edges[ i ] );
+  values.push_back( HybridInteger( M ) + 1 );
+  values.push_back( HybridInteger( m ) - 1 );
+  values.push_back( HybridInteger( M ) * M );
+  values.push_back( std::numeric_limits<DGtal::uint64_t>::max() );
+  for ( unsigned int i = 0; i < 40; ++i )
+    values.push_back( random64() );
+
+  unsigned int nbBig = 0;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    for ( unsigned int j = 0; j < values.size(); ++j )
+      {
+        const HybridInteger & a = values[ i ];
+        const HybridInteger & b = values[ j ];
+        const BigInteger ba = a.big();
+        const BigInteger bb = b.big();
+        bool ok = same( a + b, ba + bb ) && same( a - b, ba - bb )
+          && same( a * b, ba * bb ) && same( -a, -ba )
+          && ( ( a < b ) == ( ba < bb ) ) && ( ( a == b ) == ( ba == bb ) )
+          && ( ( a >= b ) == ( ba >= bb ) )
+          && ( NumberTraits<HybridInteger>::even( a ) == mpz_even_p( ba.get_mpz_t() ) );
+        if ( bb != 0 )
+          ok = ok && same( a / b, ba / bb ) && same( a % b, ba % bb );
+        HybridInteger c( a );
+        c += b; c -= b; c *= b;
+        ok = ok && same( c, ba * bb );
+        nbBig += ( a * b ).isSmall() ? 0 : 1;
+        nbok += ok ? 1 : 0; nb++;
+        if ( ! ok )
+          trace.error() << "a=" << a << " b=" << b << std::endl;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") pairs of operands, "
+               << nbBig << " big products" << std::endl;
+
+  HybridInteger x( M );
+  nbok += ( ( ++x ).isSmall() == false ) && ( ( --x ).isSmall() )
+    && ( x == HybridInteger( M ) ) ? 1 : 0; nb++;
+  nbok += ( HybridInteger( m ).big() == BigInteger( "-9223372036854775808" ) )
+    && ( HybridInteger( M ).big() == BigInteger( "9223372036854775807" ) )
+    && ( ( HybridInteger( M ) + 1 ).castToInt64_t() == m )
+    && ( ( HybridInteger( m ) - 1 ).castToInt64_t() == M )
+    && ( ( HybridInteger( M ) * 3 ).castToInt64_t() == M - 2 ) ? 1 : 0; nb++;
+  nbok += ( ( HybridInteger( m ) / -1 ) == -HybridInteger( m ) )
+    && ( ( HybridInteger( m ) % -1 ) == 0 ) ? 1 : 0; nb++;
+  std::stringstream ss;
+  ss << values[ 14 ] << " " << values[ 16 ];
+  HybridInteger r1, r2;
+  ss >> r1 >> r2;
+  nbok += ( r1 == values[ 14 ] ) && ( r2 == values[ 16 ] ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") increments, min()/-1 and i/o "
+               << r2 << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks IntegerComputer with HybridInteger on large integers.
+ */
+bool testIntegerComputer()
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<HybridInteger> ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing IntegerComputer<HybridInteger>" );
+  IntegerComputer<HybridInteger> ic;
+  IntegerComputer<BigInteger> bic;
+  for ( unsigned int i = 0; i < 100; ++i )
+    {
+      // non zero operands, possibly big.
+      HybridInteger a = HybridInteger( random64() | 1 ) * ( random64() | 1 );
+      HybridInteger b = HybridInteger( random64() | 1 );
+      HybridInteger g = ic.gcd( a, b );
+      IntegerComputer<HybridInteger>::Point2I v = ic.extendedEuclid( a, b, g );
+      bool ok = same( g, bic.gcd( a.big(), b.big() ) )
+        && ( a * v[ 0 ] + b * v[ 1 ] == g )
+        && same( ic.floorDiv( a, b ), bic.floorDiv( a.big(), b.big() ) )
+        && same( ic.ceilDiv( a, b ), bic.ceilDiv( a.big(), b.big() ) );
+      nbok += ok ? 1 : 0; nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") gcd, Bezout, floor/ceil div" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the arithmetical recognition algorithms give the same
+ * results with HybridInteger and BigInteger.
+ */
+bool testRecognition()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing recognition algorithms with HybridInteger" );
+  typedef Z3i::Space Space;
+  typedef Z3i::Point Point;
+  COBANaivePlaneComputer<Space, HybridInteger> hcoba;
+  COBANaivePlaneComputer<Space, BigInteger> bcoba;
+  ChordNaivePlaneComputer<Space, Point, HybridInteger> hchord;
+  ChordNaivePlaneComputer<Space, Point, BigInteger> bchord;
+  const int diameter = 1000;
+  for ( unsigned int k = 0; k < 5; ++k )
+    {
+      // points close to the plane 7x + 11y + 101z = 0.
+      hcoba.init( 2, 2 * diameter, 1, 1 );
+      bcoba.init( 2, 2 * diameter, 1, 1 );
+      hchord.init( 2, 1, 1 );
+      bchord.init( 2, 1, 1 );
+      bool ok = true;
+      for ( unsigned int i = 0; i < 200; ++i )
+        {
+          const int x = rand() % ( 2 * diameter ) - diameter;
+          const int y = rand() % ( 2 * diameter ) - diameter;
+          const int z = - ( 7 * x + 11 * y ) / 101 + ( rand() % 3 ) - 1;
+          const Point p( x, y, z );
+          ok = ok && ( hcoba.extend( p ) == bcoba.extend( p ) )
+            && ( hchord.extend( p ) == bchord.extend( p ) );
+        }
+      nbok += ok ? 1 : 0; nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") COBA and Chord plane recognition" << std::endl;
+
+  typedef ArithmeticalDSS<DGtal::int64_t, HybridInteger, 8> HDSS;
+  typedef ArithmeticalDSS<DGtal::int64_t, BigInteger, 8> BDSS;
+  // a long digital straight segment of slope 13/34, far from the origin.
+  const DGtal::int64_t x0 = DGtal::int64_t( 1 ) << 40;
+  HDSS hdss( HDSS::Point( x0, 0 ) );
+  BDSS bdss( BDSS::Point( x0, 0 ) );
+  bool ok = true;
+  for ( DGtal::int64_t i = 1; i < 200; ++i )
+    {
+      const HDSS::Point p( x0 + i, ( 13 * i ) / 34 );
+      ok = ok && ( hdss.extendFront( p ) == bdss.extendFront( p ) );
+    }
+  ok = ok && ( hdss.a() == bdss.a() ) && ( hdss.b() == bdss.b() )
+    && same( hdss.mu(), bdss.mu() ) && same( hdss.omega(), bdss.omega() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") ArithmeticalDSS " << hdss << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HybridInteger" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOperations() && testIntegerComputer() && testRecognition();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-multithread-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Stress test and benchmark of the concurrent use of SternBrocot,
+ * LightSternBrocot and LighterSternBrocot: subsegments of random
+ * StandardDSLQ0 are computed by several threads (OpenMP) from an
+ * empty fraction tree, then checked against a sequential computation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/LightSternBrocot.h"
+#include "DGtal/arithmetic/LighterSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the concurrent use of Stern-Brocot trees.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A DSL and a subsegment [x1,x2] of it.
+struct Query
+{
+  DGtal::int64_t a, b, mu, x1, x2;
+};
+
+/// Characteristics (a,b,mu) of the minimal DSS of a query.
+struct Answer
+{
+  DGtal::int64_t a, b, mu;
+  bool operator==( const Answer & other ) const
+  {
+    return ( a == other.a ) && ( b == other.b ) && ( mu == other.mu );
+  }
+};
+
+template <typename Fraction>
+Answer subStandardDSLQ0( const Query & query )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Point Point;
+  DSL D( query.a, query.b, query.mu );
+  Point A = D.lowestY( query.x1 );
+  Point B = D.lowestY( query.x2 );
+  DSL S = D.reversedSmartDSS( A, B );
+  Answer answer = { NumberTraits<typename Fraction::Integer>::castToInt64_t( S.a() ),
+                    NumberTraits<typename Fraction::Integer>::castToInt64_t( S.b() ),
+                    NumberTraits<typename Fraction::Integer>::castToInt64_t( S.mu() ) };
+  return answer;
+}
+
+/**
+   Computes all queries in parallel (the tree is empty at the first
+   call), then sequentially, and compares the results.
+*/
+template <typename Fraction>
+bool stressStandardDSLQ0( const std::string & name, const std::vector<Query> & queries )
+{
+  const long n = (long) queries.size();
+  std::vector<Answer> parallel( n );
+  std::vector<Answer> sequential( n );
+  int nbThreads = 1;
+  Clock c;
+  c.startClock();
+#ifdef WITH_OPENMP
+  nbThreads = omp_get_max_threads();
+#pragma omp parallel for schedule(dynamic,16)
+#endif
+  for ( long i = 0; i < n; ++i )
+    parallel[ i ] = subStandardDSLQ0<Fraction>( queries[ i ] );
+  const double tpar = c.stopClock();
+  c.startClock();
+  for ( long i = 0; i < n; ++i )
+    sequential[ i ] = subStandardDSLQ0<Fraction>( queries[ i ] );
+  const double tseq = c.stopClock();
+  const bool ok = parallel == sequential;
+  std::cout << name << " " << nbThreads << " " << n << " "
+            << tpar << " " << tseq << " " << ( ok ? "ok" : "ERROR" ) << std::endl;
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 2000;
+  DGtal::int64_t moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 12000;
+  DGtal::int64_t modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
+  DGtal::int64_t modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Query> queries;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      DGtal::int64_t a( rand() % moda + 1 );
+      DGtal::int64_t b( rand() % modb + 1 );
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      for ( unsigned int j = 0; j < 10; ++j )
+        {
+          Query q;
+          q.a = a; q.b = b; q.mu = rand() % ( moda + modb );
+          q.x1 = rand() % modx;
+          q.x2 = q.x1 + 1 + ( rand() % modx );
+          queries.push_back( q );
+        }
+    }
+
+  std::cout << "# tree threads queries parallel(ms) sequential(ms) check" << std::endl;
+  bool ok = true;
+  ok = stressStandardDSLQ0< SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "SB", queries ) && ok;
+  ok = stressStandardDSLQ0< LightSternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "LSB", queries ) && ok;
+  ok = stressStandardDSLQ0< LighterSternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "LrSB", queries ) && ok;
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSternBrocotConcurrency.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the concurrent use of SternBrocot,
+ * LightSternBrocot and LighterSternBrocot: fractions and subsegments
+ * of StandardDSLQ0 are computed by several threads (OpenMP) from an
+ * empty fraction tree, then checked against a sequential computation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/LightSternBrocot.h"
+#include "DGtal/arithmetic/LighterSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the concurrent use of Stern-Brocot trees.
+///////////////////////////////////////////////////////////////////////////////
+
+/// An irreducible fraction a/b, and a subsegment [x1,x2] of the DSL (a,b,mu).
+struct Query
+{
+  DGtal::int64_t a, b, mu, x1, x2;
+};
+
+/// A fraction p/q followed by the characteristics (a,b,mu) of the minimal DSS of a query.
+struct Answer
+{
+  DGtal::int64_t p, q, a, b, mu;
+  bool operator==( const Answer & other ) const
+  {
+    return ( p == other.p ) && ( q == other.q )
+      && ( a == other.a ) && ( b == other.b ) && ( mu == other.mu );
+  }
+};
+
+template <typename Fraction>
+Answer answer( const Query & query )
+{
+  typedef typename Fraction::Integer Integer;
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Point Point;
+  Fraction f( query.a, query.b );
+  DSL D( query.a, query.b, query.mu );
+  Point A = D.lowestY( query.x1 );
+  Point B = D.lowestY( query.x2 );
+  DSL S = D.reversedSmartDSS( A, B );
+  Answer result = { NumberTraits<Integer>::castToInt64_t( f.p() ),
+                    NumberTraits<Integer>::castToInt64_t( f.q() ),
+                    NumberTraits<Integer>::castToInt64_t( S.a() ),
+                    NumberTraits<Integer>::castToInt64_t( S.b() ),
+                    NumberTraits<Integer>::castToInt64_t( S.mu() ) };
+  return result;
+}
+
+/**
+   Computes all queries in parallel (the tree is empty at the first
+   call), then sequentially, and compares the results.
+*/
+template <typename Fraction>
+bool testConcurrency( const std::string & name, const std::vector<Query> & queries )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing concurrent use of " + name );
+  const long n = (long) queries.size();
+  std::vector<Answer> parallel( n );
+  std::vector<Answer> sequential( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,4)
+#endif
+  for ( long i = 0; i < n; ++i )
+    parallel[ i ] = answer<Fraction>( queries[ i ] );
+  for ( long i = 0; i < n; ++i )
+    sequential[ i ] = answer<Fraction>( queries[ i ] );
+  bool fractionsOk = true;
+  for ( long i = 0; i < n; ++i )
+    fractionsOk = fractionsOk && ( parallel[ i ].p == queries[ i ].a )
+      && ( parallel[ i ].q == queries[ i ].b );
+  nbok += fractionsOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fractions built in parallel are a/b" << std::endl;
+  nbok += ( parallel == sequential ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallel == sequential for " << n << " queries" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing the concurrent use of Stern-Brocot trees" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Query> queries;
+  srand( 0 );
+  while ( queries.size() < 400 )
+    {
+      Query q;
+      q.a = rand() % 2000 + 1;
+      q.b = rand() % 2000 + 1;
+      if ( ic.gcd( q.a, q.b ) != 1 ) continue;
+      q.mu = rand() % 4000;
+      q.x1 = rand() % 200;
+      q.x2 = q.x1 + 1 + ( rand() % 200 );
+      queries.push_back( q );
+    }
+
+  bool res = testConcurrency< SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "SternBrocot", queries )
+    && testConcurrency< LightSternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "LightSternBrocot", queries )
+    && testConcurrency< LighterSternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction >
+    ( "LighterSternBrocot", queries );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testProfiler.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class Profiler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Profiler.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Records nbLoops nested zones and counts them.
+ */
+void work( Profiler & p, unsigned int nbLoops )
+{
+  for ( unsigned int i = 0; i < nbLoops; ++i )
+    {
+      p.beginZone( "outer" );
+      p.beginZone( "inner" );
+      p.count( "loops", 1 );
+      p.endZone();
+      p.endZone();
+    }
+}
+
+bool testProfiler()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing nested zones and counters ..." );
+  Profiler p;
+  work( p, 10 );
+  p.beginZone( std::string( "dynamic name" ) );
+  p.endZone();
+  std::vector<Profiler::Zone> zones = p.zones();
+  bool nested = ( zones.size() == 21 );
+  for ( std::size_t i = 0; nested && i + 1 < 20; i += 2 )
+    nested = ( zones[ i ].depth == 0 ) && ( zones[ i + 1 ].depth == 1 )
+      && ( zones[ i ].start <= zones[ i + 1 ].start )
+      && ( zones[ i + 1 ].end <= zones[ i ].end );
+  nbok += nested ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << zones.size() << " zones, inner zones inside outer zones" << std::endl;
+  std::map<std::string, Profiler::ZoneStatistics> stats = p.zoneStatistics();
+  nbok += ( stats.size() == 3 ) && ( stats[ "outer" ].nbCalls == 10 )
+    && ( stats[ "dynamic name" ].nbCalls == 1 )
+    && ( stats[ "inner" ].totalTime <= stats[ "outer" ].totalTime )
+    && ( stats[ "outer" ].maxTime <= stats[ "outer" ].totalTime ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "statistics: outer=" << stats[ "outer" ].totalTime << " ns" << std::endl;
+  nbok += ( p.counters()[ "loops" ] == 10 ) && ( p.nbThreads() == 1 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << p << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing threads ..." );
+  p.clear();
+  std::vector<std::thread> threads;
+  for ( unsigned int t = 0; t < 4; ++t )
+    threads.push_back( std::thread( work, std::ref( p ), 100 ) );
+  for ( unsigned int t = 0; t < 4; ++t )
+    threads[ t ].join();
+  work( p, 1 );
+  nbok += ( p.nbThreads() == 5 ) && ( p.counters()[ "loops" ] == 401 )
+    && ( p.zoneStatistics()[ "inner" ].nbCalls == 401 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << p << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing exports ..." );
+  p.clear();
+  p.beginZone( "quoted \"zone\", with comma" );
+  p.count( "misses", 3 );
+  std::ostringstream json;
+  p.exportChromeTrace( json );
+  p.endZone();
+  std::ostringstream csv;
+  p.exportCSV( csv );
+  trace.info() << json.str() << csv.str();
+  nbok += ( json.str().find( "{\"traceEvents\":[" ) == 0 )
+    && ( json.str().find( "\"name\":\"quoted \\\"zone\\\", with comma\",\"ph\":\"X\"" ) != std::string::npos )
+    && ( json.str().find( "\"ph\":\"C\"" ) != std::string::npos ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Chrome trace export" << std::endl;
+  nbok += ( csv.str().find( "kind,name,calls,total_ns,max_ns,value\n" ) == 0 )
+    && ( csv.str().find( "zone,\"quoted \"\"zone\"\", with comma\",1," ) != std::string::npos )
+    && ( csv.str().find( "counter,misses,,,,3\n" ) != std::string::npos ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "CSV export" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Profiler" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testProfiler();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -487,6 +487,142 @@ test_hodge_sign()
     DGtal::trace.endBlock();
 }
 
+template <typename LinearAlgebraBackend>
+void
+test_cached_operators()
+{
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<2, 2, LinearAlgebraBackend> Calculus;
+    typedef DGtal::Z2i::Point Point;
+
+    DGtal::trace.beginBlock("testing cached operators");
+
+    const DGtal::Z2i::Domain domain(Point(0,0), Point(9,9));
+    DGtal::Z2i::DigitalSet set(domain);
+    for (DGtal::Z2i::Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if (((*di)[0] + 2*(*di)[1]) % 5 != 0) set.insertNew(*di);
+
+    Calculus calculus = CalculusFactory::createFromDigitalSet(set);
+
+    // cached operators are returned as long as the structure is unchanged
+    const typename Calculus::PrimalDerivative0 d0 = calculus.template derivative<0, DGtal::PRIMAL>();
+    FATAL_ERROR( equal(d0.myContainer, calculus.template derivative<0, DGtal::PRIMAL>().myContainer) );
+    const typename Calculus::DualHodge1 h1 = calculus.template hodge<1, DGtal::DUAL>();
+    FATAL_ERROR( equal(h1.myContainer, calculus.template hodge<1, DGtal::DUAL>().myContainer) );
+    {
+        const typename Calculus::PrimalIdentity0 laplace = calculus.template laplace<DGtal::PRIMAL>();
+        const typename Calculus::PrimalIdentity0 product = calculus.template antiderivative<1, DGtal::PRIMAL>() * calculus.template derivative<0, DGtal::PRIMAL>();
+        FATAL_ERROR( equal(laplace.myContainer, product.myContainer) );
+        FATAL_ERROR( equal(laplace.myContainer, calculus.template laplace<DGtal::PRIMAL>().myContainer) );
+    }
+    {
+        const typename Calculus::DualIdentity0 laplace = calculus.template laplace<DGtal::DUAL>();
+        const typename Calculus::DualIdentity0 product = calculus.template antiderivative<1, DGtal::DUAL>() * calculus.template derivative<0, DGtal::DUAL>();
+        FATAL_ERROR( equal(laplace.myContainer, product.myContainer) );
+        FATAL_ERROR( equal(laplace.myContainer, calculus.template laplace<DGtal::DUAL>().myContainer) );
+    }
+
+    // every primal edge has exactly two primal points
+    for (typename Calculus::SparseMatrix::Index kk=0; kk<d0.myContainer.rows(); kk++)
+        FATAL_ERROR( d0.myContainer.row(kk).cwiseAbs().sum() == 2 );
+
+    // structure modifications update cached operators
+    calculus.resetSizes();
+    const typename Calculus::DualHodge1 h1_reset = calculus.template hodge<1, DGtal::DUAL>();
+    FATAL_ERROR( is_identity(h1_reset.myContainer, -1) );
+
+    const typename Calculus::Index nb_spels = set.size();
+    FATAL_ERROR( calculus.eraseCell(calculus.myKSpace.uSpel(Point(1,0))) );
+    calculus.updateIndexes();
+    const typename Calculus::PrimalDerivative1 d1 = calculus.template derivative<1, DGtal::PRIMAL>();
+    FATAL_ERROR( d1.myContainer.rows() == nb_spels-1 );
+    const typename Calculus::DualIdentity0 laplace = calculus.template laplace<DGtal::DUAL>();
+    FATAL_ERROR( laplace.myContainer.rows() == nb_spels-1 );
+
+    DGtal::trace.endBlock();
+}
+
+template <typename LinearAlgebraBackend>
+void
+test_batched_solves()
+{
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<2, 2, LinearAlgebraBackend> Calculus;
+    typedef DGtal::Z2i::Point Point;
+    typedef typename Calculus::DualIdentity0 Operator;
+    typedef typename Calculus::DualForm0 Form;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
+
+    DGtal::trace.beginBlock("testing batched solves");
+
+    const DGtal::Z2i::Domain domain(Point(0,0), Point(9,9));
+    DGtal::Z2i::DigitalSet set(domain);
+    for (DGtal::Z2i::Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+        if (((*di)[0] + 2*(*di)[1]) % 5 != 0) set.insertNew(*di);
+
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+    const Operator identity = calculus.template identity<0, DGtal::DUAL>();
+    const Operator heat = identity + .5 * calculus.template laplace<DGtal::DUAL>();
+    const Operator heat_bis = identity + .25 * calculus.template laplace<DGtal::DUAL>();
+    const typename Calculus::Index length = calculus.kFormLength(0, DGtal::DUAL);
+
+    DenseMatrix inputs(length, 3);
+    for (typename Calculus::Index kk=0; kk<length; kk++)
+        for (int jj=0; jj<3; jj++)
+            inputs(kk, jj) = static_cast<double>((kk*(jj+3)) % 7) - 3.;
+
+    {
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, typename LinearAlgebraBackend::SolverSimplicialLDLT, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+        Solver solver;
+        solver.compute(heat);
+
+        // block and in place solves match single solves
+        DenseMatrix solutions;
+        solver.solve(inputs, solutions);
+        FATAL_ERROR( solutions.rows() == length && solutions.cols() == 3 );
+        Form solution(calculus);
+        for (int jj=0; jj<3; jj++)
+        {
+            const Form input(calculus, inputs.col(jj));
+            const Form expected = solver.solve(input);
+            solver.solve(input, solution);
+            FATAL_ERROR( (solution.myContainer - expected.myContainer).norm() < 1e-10 );
+            FATAL_ERROR( (solutions.col(jj) - expected.myContainer).norm() < 1e-10 );
+            solver.solveWithGuess(input, solution);
+            FATAL_ERROR( (solution.myContainer - expected.myContainer).norm() < 1e-10 );
+        }
+
+        // refactorization with the same pattern
+        Solver solver_bis;
+        solver_bis.compute(heat_bis);
+        solver.factorize(heat_bis);
+        const Form input(calculus, inputs.col(0));
+        FATAL_ERROR( (solver.solve(input).myContainer - solver_bis.solve(input).myContainer).norm() < 1e-10 );
+    }
+
+    {
+        typedef DGtal::DiscreteExteriorCalculusSolver<Calculus, typename LinearAlgebraBackend::SolverConjugateGradient, 0, DGtal::DUAL, 0, DGtal::DUAL> Solver;
+        Solver solver;
+        solver.compute(heat);
+
+        DenseMatrix solutions;
+        solver.solve(inputs, solutions);
+        FATAL_ERROR( solver.isValid() );
+        FATAL_ERROR( ((heat.myContainer * solutions) - inputs).norm() < 1e-6 * inputs.norm() );
+
+        // warm start from the solution does not iterate
+        const Form input(calculus, inputs.col(1));
+        Form solution(calculus, solutions.col(1));
+        solver.solveWithGuess(input, solution);
+        FATAL_ERROR( solver.myLinearAlgebraSolver.iterations() == 0 );
+        FATAL_ERROR( (solution.myContainer - solutions.col(1)).norm() < 1e-10 );
+        solver.solveWithGuess(inputs, solutions);
+        FATAL_ERROR( solver.myLinearAlgebraSolver.iterations() == 0 );
+    }
+
+    DGtal::trace.endBlock();
+}
+
 void
 test_duality()
 {
@@ -506,6 +642,10 @@ test_backend(const int& ntime, const int& maxdim)
 
     test_hodge_sign<LinearAlgebraBackend>();
 
+    test_cached_operators<LinearAlgebraBackend>();
+
+    test_batched_solves<LinearAlgebraBackend>();
+
     for (int kk=0; kk<ntime; kk++)
     {
         typedef DGtal::SpaceND<1, int> Space1;
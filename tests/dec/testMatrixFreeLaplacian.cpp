@@ -0,0 +1,230 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeLaplacian.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes MatrixFreeLaplacian and MatrixFreeLaplaceSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/MatrixFreeLaplacian.h"
+#include "DGtal/dec/MatrixFreeLaplaceSolver.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus2D;
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus3D;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes MatrixFreeLaplacian and MatrixFreeLaplaceSolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the matrix-free operator to the assembled one.
+ */
+template <typename Calculus, Duality duality>
+bool testApply( const Calculus & calculus, double a, double b )
+{
+  typedef MatrixFreeLaplacian<Calculus, duality> Laplacian;
+  typedef typename Laplacian::Form Form;
+  const Laplacian laplacian( calculus, a, b );
+  Form input( calculus );
+  input.myContainer = Calculus::DenseVector::Random( input.length() );
+
+  const Form output = laplacian * input;
+  const typename Calculus::DenseVector expected =
+    a * input.myContainer + b * ( calculus.template laplace<duality>().myContainer * input.myContainer );
+  const double error = ( output.myContainer - expected ).cwiseAbs().maxCoeff();
+  trace.info() << laplacian << " a=" << a << " b=" << b << " error=" << error << endl;
+  return laplacian.isValid() && laplacian.size() == input.length() && error < 1e-12;
+}
+
+bool testMatrixFreeLaplacian()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Matrix-free application..." );
+  Z2i::DigitalSet set_2d( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 20, 20 ) ) );
+  Shapes<Z2i::Domain>::addNorm2Ball( set_2d, Z2i::Point( 10, 10 ), 8 );
+  Z3i::DigitalSet set_3d( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 12, 12, 12 ) ) );
+  Shapes<Z3i::Domain>::addNorm2Ball( set_3d, Z3i::Point( 6, 6, 6 ), 5 );
+  for ( int border = 0; border < 2; border++ )
+    {
+      const Calculus2D calculus_2d = CalculusFactory::createFromDigitalSet( set_2d, border == 1 );
+      const Calculus3D calculus_3d = CalculusFactory::createFromDigitalSet( set_3d, border == 1 );
+      nbok += testApply<Calculus2D, PRIMAL>( calculus_2d, 0, 1 ) ? 1 : 0; nb++;
+      nbok += testApply<Calculus2D, DUAL>( calculus_2d, 0, 1 ) ? 1 : 0; nb++;
+      nbok += testApply<Calculus3D, PRIMAL>( calculus_3d, 0, 1 ) ? 1 : 0; nb++;
+      nbok += testApply<Calculus3D, DUAL>( calculus_3d, 0, 1 ) ? 1 : 0; nb++;
+      nbok += testApply<Calculus2D, DUAL>( calculus_2d, 1, -.5 ) ? 1 : 0; nb++;
+      nbok += testApply<Calculus3D, PRIMAL>( calculus_3d, 2, .3 ) ? 1 : 0; nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "matrix-free == assembled" << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Coarsening..." );
+  {
+    typedef MatrixFreeLaplacian<Calculus3D, DUAL> Laplacian;
+    typedef Laplacian::Stencil Stencil;
+    const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set_3d, true );
+    const Laplacian laplacian( calculus );
+    Stencil coarse;
+    std::vector<Calculus3D::Index> parents;
+    Laplacian::coarsen( laplacian.stencil(), coarse, parents );
+
+    // P^t.S.P applied to a coarse vector.
+    const Calculus3D::DenseVector coarse_input = Calculus3D::DenseVector::Random( coarse.size() );
+    Calculus3D::DenseVector fine_input( laplacian.size() );
+    for ( Calculus3D::Index index = 0; index < laplacian.size(); index++ )
+      fine_input( index ) = coarse_input( parents[ index ] );
+    Calculus3D::DenseVector fine_output;
+    laplacian.applySymmetric( fine_input, fine_output );
+    Calculus3D::DenseVector expected = Calculus3D::DenseVector::Zero( coarse.size() );
+    for ( Calculus3D::Index index = 0; index < laplacian.size(); index++ )
+      expected( parents[ index ] ) += fine_output( index );
+    Calculus3D::DenseVector coarse_output;
+    Laplacian::applyStencil( coarse, coarse_input, coarse_output );
+    const double error = ( coarse_output - expected ).cwiseAbs().maxCoeff();
+    trace.info() << "fine=" << laplacian.size() << " coarse=" << coarse.size()
+                 << " error=" << error << endl;
+    nbok += ( coarse.size() < laplacian.size() && error < 1e-12 ) ? 1 : 0; nb++;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "coarse stencil == galerkin operator" << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Solving..." );
+  {
+    typedef MatrixFreeLaplaceSolver<Calculus3D, DUAL> Solver;
+    Z3i::DigitalSet set( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 23, 23, 23 ) ) );
+    Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 12, 12, 12 ), 10 );
+    const Calculus3D calculus = CalculusFactory::createFromDigitalSet( set, true );
+    Calculus3D::DualForm0 input( calculus );
+    input.myContainer = Calculus3D::DenseVector::Random( input.length() );
+
+    typedef DiscreteExteriorCalculusSolver<Calculus3D, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> DirectSolver;
+    DirectSolver direct_solver;
+    direct_solver.compute( calculus.laplace<DUAL>() );
+    const Calculus3D::DualForm0 expected = direct_solver.solve( input );
+
+    const Solver::Operator laplacian( calculus );
+    Solver plain_solver;
+    plain_solver.setMultigrid( false );
+    plain_solver.setTolerance( 1e-10 );
+    plain_solver.compute( laplacian );
+    const Calculus3D::DualForm0 plain_solution = plain_solver.solve( input );
+    const double plain_error = ( plain_solution.myContainer - expected.myContainer ).norm() / expected.myContainer.norm();
+    trace.info() << plain_solver << " error=" << plain_error << endl;
+    nbok += ( plain_solver.isValid() && plain_solver.nbLevels() == 0 && plain_error < 1e-8 ) ? 1 : 0; nb++;
+
+    Solver solver;
+    solver.setTolerance( 1e-10 );
+    solver.compute( laplacian );
+    const Calculus3D::DualForm0 solution = solver.solve( input );
+    const double error = ( solution.myContainer - expected.myContainer ).norm() / expected.myContainer.norm();
+    trace.info() << solver << " error=" << error << endl;
+    nbok += ( solver.isValid() && solver.nbLevels() > 1 && error < 1e-8 ) ? 1 : 0; nb++;
+    nbok += ( solver.iterations() < plain_solver.iterations() ) ? 1 : 0; nb++;
+
+    // Heat step.
+    const Solver::Operator heat( calculus, 1, .5 );
+    solver.compute( heat );
+    const Calculus3D::DualForm0 heat_solution = solver.solve( input );
+    const Calculus3D::DualForm0 heat_image = heat * heat_solution;
+    const double heat_error = ( heat_image.myContainer - input.myContainer ).norm() / input.myContainer.norm();
+    trace.info() << solver << " residual=" << heat_error << endl;
+    nbok += ( solver.isValid() && heat_error < 1e-8 ) ? 1 : 0; nb++;
+
+    // Warm start, in place and block solves.
+    Calculus3D::DualForm0 warm_solution = heat_solution;
+    solver.solveWithGuess( input, warm_solution );
+    trace.info() << solver << " warm start" << endl;
+    nbok += ( solver.isValid() && solver.iterations() == 0 ) ? 1 : 0; nb++;
+    Calculus3D::DenseMatrix inputs( input.length(), 2 );
+    inputs.col( 0 ) = input.myContainer;
+    inputs.col( 1 ) = heat_image.myContainer * 2;
+    Calculus3D::DenseMatrix solutions;
+    solver.solve( inputs, solutions );
+    solver.solve( input, warm_solution );
+    const double block_error = std::max( ( solutions.col( 0 ) - warm_solution.myContainer ).norm(),
+                                         ( solutions.col( 1 ) - 2 * heat_solution.myContainer ).norm() )
+      / heat_solution.myContainer.norm();
+    trace.info() << solver << " block error=" << block_error << endl;
+    nbok += ( solver.isValid() && block_error < 1e-7 ) ? 1 : 0; nb++;
+  }
+  {
+    // Singular primal laplacian with a compatible input.
+    typedef MatrixFreeLaplaceSolver<Calculus2D, PRIMAL> Solver;
+    const Calculus2D calculus = CalculusFactory::createFromDigitalSet( set_2d, false );
+    const Solver::Operator laplacian( calculus );
+    Calculus2D::PrimalForm0 input( calculus );
+    input.myContainer = Calculus2D::DenseVector::Random( input.length() );
+    const Calculus2D::DenseVector inverse_weights = laplacian.hodgeWeights().cwiseInverse();
+    input.myContainer.array() -= input.myContainer.dot( inverse_weights ) / inverse_weights.sum();
+
+    Solver solver;
+    solver.compute( laplacian );
+    const Calculus2D::PrimalForm0 solution = solver.solve( input );
+    const Calculus2D::PrimalForm0 image = laplacian * solution;
+    const double residual = ( image.myContainer - input.myContainer ).norm() / input.myContainer.norm();
+    trace.info() << solver << " residual=" << residual << endl;
+    nbok += ( solver.isValid() && residual < 1e-6 ) ? 1 : 0; nb++;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "matrix-free solutions" << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing classes MatrixFreeLaplacian and MatrixFreeLaplaceSolver" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMatrixFreeLaplacian();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+typedef FreemanChain<int> Chain;
+typedef PackedFreemanChain<int> PackedChain;
+
+/**
+ * Test that a packed chain has the same codes and points as a Freeman chain.
+ */
+bool samePoints( const Chain & fc, const PackedChain & pfc )
+{
+  if ( ( fc.size() != pfc.size() ) || ( ! pfc.isValid() ) ) return false;
+  for ( unsigned int i = 0; i < fc.size(); ++i )
+    if ( fc.code( i ) != pfc.code( i ) ) return false;
+  Chain::ConstIterator it = fc.begin();
+  PackedChain::ConstIterator itp = pfc.begin();
+  for ( unsigned int i = 0; it != fc.end(); ++it, ++itp, ++i )
+    if ( ( itp == pfc.end() ) || ( *it != *itp ) || ( *it != pfc.getPoint( i ) ) )
+      return false;
+  return ( itp == pfc.end() ) && ( pfc.lastPoint() == Chain::Point( fc.xn, fc.yn ) );
+}
+
+/**
+ * Test constructors and point decoding.
+ */
+bool testPackedFreemanChain()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing PackedFreemanChain constructors and points" );
+  std::string s = "00001030003222321222";
+  Chain c1( s, -42, 12 );
+  PackedChain p1( s, -42, 12 );
+  PackedChain p2( c1 );
+  std::stringstream ss;
+  ss << "# comment" << endl << "-42 12 " << s << endl;
+  PackedChain p3( ss );
+  nbok += samePoints( c1, p1 ) ? 1 : 0; nb++;
+  nbok += samePoints( c1, p2 ) ? 1 : 0; nb++;
+  nbok += samePoints( c1, p3 ) ? 1 : 0; nb++;
+  nbok += ( p1.freemanChain() == c1 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << p1 << endl;
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open( filename.c_str(), std::ios::in );
+  Chain fc( fst );
+  fst.close();
+  fst.open( filename.c_str(), std::ios::in );
+  PackedChain pfc( fst );
+  nbok += samePoints( fc, pfc ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << pfc.size() << " codes in "
+               << pfc.memorySize() << " bytes" << endl;
+
+  // random access
+  bool ok = true;
+  PackedChain::ConstIterator itb = pfc.begin();
+  std::vector<Chain::Point> points( fc.begin(), fc.end() );
+  for ( unsigned int i = 0; i < points.size(); i += 997 )
+    {
+      PackedChain::ConstIterator it = itb + i;
+      ok = ok && ( *it == points[ i ] ) && ( it - itb == (std::ptrdiff_t) i )
+        && ( itb[ i ] == points[ i ] ) && ( ( i == 0 ) || ( *( --it ) == points[ i - 1 ] ) );
+    }
+  PackedChain::ConstIterator ite = pfc.end();
+  --ite;
+  ok = ok && ( *ite == points.back() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") random access" << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing PackedFreemanChain input/output" );
+  std::stringstream bin( std::ios::in | std::ios::out | std::ios::binary );
+  nbok += pfc.writeBinary( bin ) ? 1 : 0; nb++;
+  PackedChain pfc2;
+  nbok += PackedChain::readBinary( bin, pfc2 ) ? 1 : 0; nb++;
+  nbok += samePoints( fc, pfc2 ) ? 1 : 0; nb++;
+  std::stringstream txt;
+  txt << pfc << endl;
+  PackedChain pfc3( txt );
+  nbok += samePoints( fc, pfc3 ) ? 1 : 0; nb++;
+  std::stringstream bad( "0 0 0123" );
+  nbok += ( ! PackedChain::readBinary( bad, pfc2 ) && ( pfc2.size() == 0 ) ) ? 1 : 0; nb++;
+  // A truncated stream and an implausible number of codes are rejected.
+  const std::string bytes = bin.str();
+  std::stringstream truncated( bytes.substr( 0, bytes.size() - 1 ) );
+  nbok += ( ! PackedChain::readBinary( truncated, pfc2 ) && ( pfc2.size() == 0 ) ) ? 1 : 0; nb++;
+  std::string huge = bytes;
+  for ( unsigned int i = 24; i < 32; ++i ) huge[ i ] = (char) 0x7f;
+  std::stringstream hugeStream( huge );
+  nbok += ( ! PackedChain::readBinary( hugeStream, pfc2 ) && ( pfc2.size() == 0 ) ) ? 1 : 0; nb++;
+  // Non-zero bits after the last code are rejected.
+  PackedChain odd( "0123012", 0, 0 );
+  std::stringstream oddBin( std::ios::in | std::ios::out | std::ios::binary );
+  odd.writeBinary( oddBin );
+  std::string padded = oddBin.str();
+  padded[ padded.size() - 1 ] = (char) 0x80;
+  std::stringstream paddedStream( padded );
+  nbok += ( ! PackedChain::readBinary( paddedStream, pfc2 ) && ( pfc2.size() == 0 ) ) ? 1 : 0; nb++;
+  // Malformed coordinates leave the chain empty.
+  std::stringstream malformed( "x y 0123" );
+  PackedChain p6( malformed );
+  nbok += ( ( p6.size() == 0 ) && p6.isValid() ) ? 1 : 0; nb++;
+  // Empty streams and last lines without a newline.
+  std::stringstream empty( "# no chain" );
+  PackedChain p4( empty );
+  nbok += ( ( p4.size() == 0 ) && p4.isValid() ) ? 1 : 0; nb++;
+  std::stringstream noNewline( "-42 12 " + s );
+  PackedChain p5( noNewline );
+  nbok += samePoints( c1, p5 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing segmentation of a PackedFreemanChain" );
+  typedef ArithmeticalDSSComputer<PackedChain::ConstIterator,int,4> PackedDSS;
+  typedef ArithmeticalDSSComputer<Chain::ConstIterator,int,4> DSS;
+  GreedySegmentation<PackedDSS> ps( pfc.begin(), pfc.end(), PackedDSS() );
+  GreedySegmentation<DSS> segmentation( fc.begin(), fc.end(), DSS() );
+  std::vector<PackedDSS> psegments;
+  ps.segments( psegments );
+  unsigned int nbSegments = 0;
+  ok = true;
+  for ( GreedySegmentation<DSS>::SegmentComputerIterator it = segmentation.begin(), itE = segmentation.end();
+        it != itE; ++it, ++nbSegments )
+    ok = ok && ( nbSegments < psegments.size() )
+      && ( it->begin().position() == psegments[ nbSegments ].begin().position() )
+      && ( it->end().position() == psegments[ nbSegments ].end().position() );
+  nbok += ( ok && ( nbSegments == psegments.size() ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbSegments << " segments" << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedFreemanChain" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPackedFreemanChain();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -935,6 +935,121 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Segments given by the iteration
+ */
+template <typename Segmentation>
+std::vector<typename Segmentation::SegmentComputer> 
+iteratedSegments(const Segmentation& s) 
+{
+  std::vector<typename Segmentation::SegmentComputer> v; 
+  for (typename Segmentation::SegmentComputerIterator it = s.begin(), itEnd = s.end(); 
+       it != itEnd; ++it) 
+    v.push_back( *it ); 
+  return v; 
+}
+
+/**
+ * Checks that two sequences of segments are the same 
+ */
+template <typename SegmentComputer>
+bool sameSegments(const std::vector<SegmentComputer>& v1, 
+                  const std::vector<SegmentComputer>& v2)
+{
+  if (v1.size() != v2.size()) return false; 
+  for (unsigned int i = 0; i < v1.size(); ++i) 
+    if ( (v1[i].begin() != v2[i].begin()) || (v1[i].end() != v2[i].end()) ) 
+      return false; 
+  return true; 
+}
+
+template <typename Segmentation>
+bool segmentsByChunksTest(const std::vector<std::string>& modes, 
+                          const typename Segmentation::ConstIterator& itb, 
+                          const typename Segmentation::ConstIterator& ite)
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer; 
+  typedef typename Segmentation::ConstIterator ConstIterator; 
+
+  unsigned int nb = 0; 
+  unsigned int nbok = 0; 
+  const unsigned int nbChunks[] = { 0, 2, 7, 1000 }; 
+  const long n = ite - itb; 
+  for (unsigned int m = 0; m < modes.size(); ++m) 
+    {
+      //whole range, then a subrange
+      for (unsigned int r = 0; r < 2; ++r) 
+        {
+          Segmentation s(itb, ite, SegmentComputer()); 
+          if (r == 1) s.setSubRange(itb + n/5, itb + 4*n/5); 
+          s.setMode(modes[m]); 
+          const std::vector<SegmentComputer> expected = iteratedSegments(s); 
+          for (unsigned int c = 0; c < 4; ++c) 
+            {
+              std::vector<SegmentComputer> v; 
+              s.segments(v, nbChunks[c]); 
+              nb++; 
+              if ( sameSegments(expected, v) ) nbok++; 
+            }
+        }
+      //batch
+      std::vector< std::pair<ConstIterator,ConstIterator> > ranges; 
+      for (long i = 0; i < 10; ++i) 
+        ranges.push_back( std::make_pair( itb + n*i/10, itb + n*(i+1)/10 ) ); 
+      std::vector< std::vector<SegmentComputer> > results; 
+      Segmentation::batchSegments(ranges, SegmentComputer(), results, modes[m]); 
+      for (unsigned int i = 0; i < ranges.size(); ++i) 
+        {
+          Segmentation s(ranges[i].first, ranges[i].second, SegmentComputer()); 
+          s.setMode(modes[m]); 
+          nb++; 
+          if ( sameSegments(iteratedSegments(s), results[i]) ) nbok++; 
+        }
+      trace.info() << "(" << nbok << "/" << nb << ") mode " << modes[m] << endl;
+    }
+  return (nb == nbok); 
+}
+
+/**
+ * Segmentations computed at once
+ */
+bool segmentsByChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+  vPts.resize(vPts.size() / 4); //a quarter of the curve is enough
+
+  trace.beginBlock("Greedy segmentation by chunks and by batch");
+  std::vector<std::string> greedyModes; 
+  greedyModes.push_back("Truncate"); 
+  greedyModes.push_back("Truncate+1"); 
+  greedyModes.push_back("DoNotTruncate"); 
+  bool res = segmentsByChunksTest< GreedySegmentation<RecognitionAlgorithm> >
+    (greedyModes, vPts.begin(), vPts.end()); 
+  trace.endBlock();
+
+  trace.beginBlock("Saturated segmentation by chunks and by batch");
+  std::vector<std::string> saturatedModes; 
+  saturatedModes.push_back("First"); 
+  saturatedModes.push_back("MostCentered"); 
+  saturatedModes.push_back("Last++"); 
+  res = res && segmentsByChunksTest< SaturatedSegmentation<RecognitionAlgorithm> >
+    (saturatedModes, vPts.begin(), vPts.end()); 
+  trace.endBlock();
+
+  return res; 
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1066,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& segmentsByChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
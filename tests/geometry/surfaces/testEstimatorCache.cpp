@@ -32,7 +32,9 @@
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
+#include <sstream>
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/geometry/surfaces/estimation/FlatEstimatorCache.h"
 ///
 /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -47,6 +49,9 @@
 /// Estimator
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/surfaces/estimation/LocalEstimatorFromSurfelFunctorAdapter.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/ElementaryConvolutionNormalVectorEstimator.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -184,6 +189,65 @@ bool testEstimatorCache(double h)
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
 	       << "cache == eval" << std::endl;
+
+  trace.beginBlock( "Flat cache ...");
+  typedef FlatEstimatorCache<MyIICurvatureEstimator> FlatGaussianCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<FlatGaussianCache> ));
+  FlatGaussianCache flatCache( curvatureEstimator );
+  flatCache.init( h, surf.begin(), surf.end() );
+  FlatGaussianCache flatCache4( curvatureEstimator );
+  flatCache4.init( h, surf.begin(), surf.end(), 4 );
+  std::stringstream bin( std::ios::in | std::ios::out | std::ios::binary );
+  bool flatOk = flatCache.writeBinary( bin );
+  FlatGaussianCache loadedCache;
+  flatOk = flatOk && loadedCache.readBinary( bin ) && loadedCache.isValid()
+    && ( loadedCache.h() == h ) && ( loadedCache.size() == cache.size() )
+    && ( flatCache.quantities() == flatCache4.quantities() );
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    flatOk = flatOk && ( flatCache.eval(it) == cache.eval(it) )
+      && ( loadedCache.eval(*it) == cache.eval(it) )
+      && ( loadedCache.surfel( loadedCache.index( *it ) ) == *it );
+  std::stringstream bad( "DGtalFEC" );
+  flatOk = flatOk && ! loadedCache.readBinary( bad ) && ( loadedCache.size() == 0 );
+  // Truncated streams and implausible sizes are rejected.
+  const std::string bytes = bin.str();
+  std::stringstream truncated( bytes.substr( 0, bytes.size() - 1 ) );
+  flatOk = flatOk && ! loadedCache.readBinary( truncated ) && ( loadedCache.size() == 0 );
+  std::string huge = bytes;
+  for ( unsigned int i = 24; i < 32; ++i ) huge[ i ] = (char) 0x7f;
+  std::stringstream hugeStream( huge );
+  flatOk = flatOk && ! loadedCache.readBinary( hugeStream ) && ( loadedCache.size() == 0 );
+  trace.info() << flatCache << std::endl;
+  trace.endBlock();
+  nbok += flatOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "flat cache == cache" << std::endl;
+
+  trace.beginBlock( "Flat cache of a functor adapter ...");
+  typedef functors::ElementaryConvolutionNormalVectorEstimator<Z3i::KSpace::Surfel, CanonicSCellEmbedder<Z3i::KSpace> > NormalFunctor;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<Boundary, Z3i::L2Metric,
+                                                 NormalFunctor, functors::GaussianKernel> NormalEstimator;
+  typedef FlatEstimatorCache<NormalEstimator> FlatNormalCache;
+  // Chunks of the adapter are evaluated by its evalParallel method,
+  // never by copies sharing the functor.
+  static_assert( detail::FlatEstimatorCacheHasEvalParallel<NormalEstimator>::value, "" );
+  static_assert( detail::FlatEstimatorCacheSharedCopies<NormalEstimator>::value, "" );
+  static_assert( ! detail::FlatEstimatorCacheHasEvalParallel<MyIICurvatureEstimator>::value, "" );
+  CanonicSCellEmbedder<Z3i::KSpace> embedder( K );
+  NormalFunctor normalFunctor( embedder, h );
+  functors::GaussianKernel gaussian( 1.0 );
+  NormalEstimator normalEstimator( surf, Z3i::l2Metric, normalFunctor, gaussian );
+  normalEstimator.setParams( Z3i::l2Metric, normalFunctor, gaussian, 3.0 );
+  FlatNormalCache normalCache( normalEstimator );
+  normalCache.init( h, surf.begin(), surf.end() );
+  FlatNormalCache normalCache4( normalEstimator );
+  normalCache4.init( h, surf.begin(), surf.end(), 4 );
+  trace.endBlock();
+  nbok += ( normalCache.quantities() == normalCache4.quantities() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "adapter cached with 1 chunk == with 4 chunks" << std::endl;
   
   return nbok == nb;
 }
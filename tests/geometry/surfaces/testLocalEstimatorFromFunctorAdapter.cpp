@@ -168,6 +168,38 @@ bool testLocalEstimatorFromFunctorAdapter()
   nb++;
 
   trace.endBlock();
+
+  trace.beginBlock("Comparing visitor, indexed and parallel evaluations");
+  typedef DGtal::functors::ElementaryConvolutionNormalVectorEstimator<Surfel, CanonicSCellEmbedder<KSpace> > NormalFunctor;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric,
+                                                 NormalFunctor, DGtal::functors::GaussianKernel> NormalReporter;
+  NormalFunctor normalFunctor( embedder, 1.0 );
+  NormalReporter normalReporter( surface, l2Metric, normalFunctor, gaussKernelFunc );
+  normalReporter.setParams( l2Metric, normalFunctor, gaussKernelFunc, 4.0 );
+  normalReporter.init( 1.0, surface.begin(), surface.end() );
+  // The reference is computed by another adapter with single
+  // evaluations only: it never indexes the surface, hence uses the
+  // visitor.
+  NormalFunctor visitorFunctor( embedder, 1.0 );
+  NormalReporter visitorReporter( surface, l2Metric, visitorFunctor, gaussKernelFunc );
+  visitorReporter.setParams( l2Metric, visitorFunctor, gaussKernelFunc, 4.0 );
+  visitorReporter.init( 1.0, surface.begin(), surface.end() );
+  std::vector<NormalFunctor::Quantity> reference;
+  for ( ConstIterator it = surface.begin(), it_end = surface.end(); it != it_end; ++it )
+    reference.push_back( visitorReporter.eval( it ) );
+  std::vector<NormalFunctor::Quantity> indexed;
+  normalReporter.eval( surface.begin(), surface.end(), std::back_inserter( indexed ) );
+  std::vector<NormalFunctor::Quantity> parallel;
+  normalReporter.evalParallel( surface.begin(), surface.end(), std::back_inserter( parallel ) );
+  nbok += ( reference == indexed ) ? 1 : 0;
+  nb++;
+  nbok += ( reference == parallel ) ? 1 : 0;
+  nb++;
+  nbok += ( normalReporter.eval( surface.begin() ) == reference.front() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << reference.size() << " normals evaluated" << std::endl;
+  trace.endBlock();
   trace.endBlock();
 
   nbok += true ? 1 : 0;
@@ -0,0 +1,198 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMaximalPlanesOnDigitalSurface.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MaximalPlanesOnDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/implicit/ImplicitRoundedHyperCube.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/MaximalPlanesOnDigitalSurface.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MaximalPlanesOnDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImplicitRoundedHyperCube<Z3i::Space> ImplicitShape;
+typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+typedef LightImplicitDigitalSurface<Z3i::KSpace, DigitalShape> Boundary;
+typedef DigitalSurface<Boundary> MyDigitalSurface;
+typedef MyDigitalSurface::Surfel Surfel;
+
+/**
+ * Grows the maximal plane around @a seed with a BreadthFirstVisitor
+ * (reference implementation). Returns the radius and the number of
+ * surfels.
+ */
+template <typename PlaneComputer>
+std::pair<unsigned int, unsigned int>
+growWithVisitor( const Z3i::KSpace & K, const MyDigitalSurface & surface,
+                 const PlaneComputer & prototype, const Surfel & seed,
+                 unsigned int maxRadius )
+{
+  typedef BreadthFirstVisitor<MyDigitalSurface> Visitor;
+  PlaneComputer computer( prototype );
+  Visitor visitor( surface, seed );
+  std::vector<Z3i::Point> layer;
+  unsigned int distance = 0;
+  unsigned int radius = 0;
+  unsigned int nb = 0;
+  while ( ! visitor.finished() )
+    {
+      Visitor::Node node = visitor.current();
+      if ( node.second > maxRadius ) break;
+      if ( node.second != distance )
+        {
+          if ( ! computer.extend( layer.begin(), layer.end() ) )
+            return std::make_pair( radius, nb );
+          nb += layer.size();
+          radius = distance;
+          layer.clear();
+          distance = node.second;
+        }
+      const Surfel s = node.first;
+      layer.push_back( K.sCoords( K.sDirectIncident( s, K.sOrthDir( s ) ) ) );
+      visitor.expand();
+    }
+  if ( ! layer.empty() && computer.extend( layer.begin(), layer.end() ) )
+    {
+      nb += layer.size();
+      radius = distance;
+    }
+  return std::make_pair( radius, nb );
+}
+
+/**
+ * Compares MaximalPlanesOnDigitalSurface with and without reuse with
+ * the reference implementation.
+ */
+template <typename PlaneComputer>
+bool checkMaximalPlanes( const std::string & name,
+                         const Z3i::KSpace & K, const MyDigitalSurface & surface,
+                         const PlaneComputer & prototype, unsigned int maxRadius )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Maximal planes with " + name );
+  typedef MaximalPlanesOnDigitalSurface<MyDigitalSurface, PlaneComputer> MaximalPlanes;
+  typedef typename MaximalPlanes::Index Index;
+  Clock c;
+  MaximalPlanes planes( surface );
+  MaximalPlanes planesNoReuse( surface );
+  c.startClock();
+  planes.init( prototype, maxRadius );
+  const double t1 = c.stopClock();
+  c.startClock();
+  planesNoReuse.init( prototype, maxRadius, false );
+  const double t2 = c.stopClock();
+  trace.info() << planes << " " << t1 << " ms (reuse), " << t2 << " ms (no reuse)" << std::endl;
+  nbok += ( planes.isValid() && ( planes.size() == surface.size() ) ) ? 1 : 0; nb++;
+
+  bool ok = true;
+  bool same = true;
+  unsigned int maxR = 0;
+  double thickness = 0.0;
+  for ( Index i = 0; i < planes.size(); ++i )
+    {
+      ok = ok && ( planes.index( planes.surfel( i ) ) == i );
+      same = same && ( planes.radius( i ) == planesNoReuse.radius( i ) )
+        && ( planes.nbSurfels( i ) == planesNoReuse.nbSurfels( i ) );
+      maxR = std::max( maxR, planes.radius( i ) );
+      thickness = std::max( thickness, (double) planes.width( i ) );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same radii with and without reuse,"
+               << " max radius=" << maxR << " max axis width=" << thickness << std::endl;
+
+  ok = true;
+  for ( Index i = 0; i < planes.size(); i += 7 )
+    {
+      const std::pair<unsigned int, unsigned int> ref
+        = growWithVisitor( K, surface, prototype, planes.surfel( i ), maxRadius );
+      ok = ok && ( ref.first == planes.radius( i ) ) && ( ref.second == planes.nbSurfels( i ) );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same radii as BreadthFirstVisitor" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testMaximalPlanesOnDigitalSurface()
+{
+  trace.beginBlock( "Shape initialisation ..." );
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), 10.0, 6.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -12.0, -12.0, -12.0 ), Z3i::RealPoint( 12.0, 12.0, 12.0 ), 1.0 );
+  Z3i::KSpace K;
+  K.init( dshape.getLowerBound(), dshape.getUpperBound(), true );
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surface( boundary );
+  trace.info() << "Digital surface has " << surface.size() << " surfels." << std::endl;
+  trace.endBlock();
+
+  COBAGenericNaivePlaneComputer<Z3i::Space, DGtal::int64_t> coba;
+  coba.init( 100, 1, 1 );
+  ChordGenericNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> chord;
+  chord.init( 1, 1 );
+  return checkMaximalPlanes( "COBA", K, surface, coba, 8 )
+    && checkMaximalPlanes( "Chord", K, surface, chord, 12 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MaximalPlanesOnDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMaximalPlanesOnDigitalSurface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
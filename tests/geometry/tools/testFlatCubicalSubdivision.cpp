@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatCubicalSubdivision.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FlatCubicalSubdivision.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/geometry/tools/FlatCubicalSubdivision.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FlatCubicalSubdivision.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing FlatCubicalSubdivision" )
+{
+  typedef Z3i::Space Space;
+  typedef Z3i::Point Point;
+  Point lo( -10, -5, 0 );
+  Point up( 30, 20, 17 );
+  srand( 0 );
+  std::vector<Point> pts;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    pts.push_back( Point( lo[ 0 ] + rand() % 41, lo[ 1 ] + rand() % 26, lo[ 2 ] + rand() % 18 ) );
+  pts.push_back( pts[ 10 ] ); // duplicated point
+
+  SpatialCubicalSubdivision<Space> scs( lo, up, 4 );
+  scs.push( pts.begin(), pts.end() );
+  FlatCubicalSubdivision<Space> fcs( lo, up, 4 );
+  fcs.init( pts.begin(), pts.end() );
+
+  SECTION( "Same bins and same number of points as SpatialCubicalSubdivision" )
+    {
+      REQUIRE( fcs.isValid() );
+      REQUIRE( fcs.size() == pts.size() );
+      REQUIRE( fcs.binDomain().lowerBound() == scs.binDomain().lowerBound() );
+      REQUIRE( fcs.binDomain().upperBound() == scs.binDomain().upperBound() );
+      REQUIRE( fcs.bin( Point( 3, 7, 11 ) ) == scs.bin( Point( 3, 7, 11 ) ) );
+      REQUIRE( fcs.uppermost( Point( 1, 2, 3 ) ) == scs.uppermost( Point( 1, 2, 3 ) ) );
+    }
+
+  SECTION( "Box queries return the same points in the same order" )
+    {
+      unsigned int nbOk = 0;
+      for ( unsigned int i = 0; i < 100; ++i )
+        {
+          Point b = fcs.bin( pts[ i ] );
+          std::vector<Point> v1, v2;
+          scs.getPoints( v1, b - Point::diagonal( 1 ), b + Point::diagonal( 1 ) );
+          fcs.getPoints( v2, b - Point::diagonal( 1 ), b + Point::diagonal( 1 ) );
+          if ( v1 == v2 ) nbOk++;
+        }
+      REQUIRE( nbOk == 100 );
+    }
+
+  SECTION( "Ball queries return the points at distance at most radius" )
+    {
+      unsigned int nbOk = 0;
+      for ( unsigned int i = 0; i < 100; ++i )
+        {
+          const Point c = pts[ 3 * i ];
+          std::vector<Point> v;
+          fcs.getPointsInBall( v, c, 3.5 );
+          unsigned int nbIn = 0;
+          for ( auto p : pts )
+            if ( ( p - c ).dot( p - c ) <= 3.5 * 3.5 ) nbIn++;
+          bool ok = v.size() == nbIn;
+          for ( auto p : v ) ok = ok && ( ( p - c ).dot( p - c ) <= 3.5 * 3.5 );
+          if ( ok ) nbOk++;
+        }
+      REQUIRE( nbOk == 100 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKdTree.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class KdTree.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/KdTree.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KdTree.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Brute force k-nearest neighbors, sorted by (distance,index).
+template <typename Point, typename QueryPoint>
+std::vector<std::size_t> bruteForce( const std::vector<Point> & pts,
+                                     const QueryPoint & q,
+                                     std::size_t k, double radius )
+{
+  std::vector< std::pair<double, std::size_t> > c;
+  for ( std::size_t i = 0; i < pts.size(); ++i )
+    {
+      double d2 = 0.0;
+      for ( Dimension j = 0; j < Point::dimension; ++j )
+        d2 += ( (double) pts[ i ][ j ] - q[ j ] ) * ( (double) pts[ i ][ j ] - q[ j ] );
+      if ( d2 <= radius * radius ) c.push_back( std::make_pair( d2, i ) );
+    }
+  std::sort( c.begin(), c.end() );
+  std::vector<std::size_t> result;
+  for ( std::size_t i = 0; i < std::min( k, c.size() ); ++i )
+    result.push_back( c[ i ].second );
+  return result;
+}
+
+TEST_CASE( "Testing KdTree on real points" )
+{
+  typedef Z3i::RealPoint RealPoint;
+  srand( 0 );
+  std::vector<RealPoint> pts;
+  for ( unsigned int i = 0; i < 5000; ++i )
+    pts.push_back( RealPoint( rand() / (double) RAND_MAX, 
+                              rand() / (double) RAND_MAX,
+                              rand() / (double) RAND_MAX ) );
+  KdTree<RealPoint> tree( pts.begin(), pts.end() );
+  std::vector<RealPoint> queries;
+  for ( unsigned int i = 0; i < 100; ++i )
+    queries.push_back( RealPoint( 1.2 * rand() / (double) RAND_MAX - 0.1, 
+                                  1.2 * rand() / (double) RAND_MAX - 0.1,
+                                  1.2 * rand() / (double) RAND_MAX - 0.1 ) );
+
+  SECTION( "Tree is valid and keeps input points" )
+    {
+      REQUIRE( tree.isValid() );
+      REQUIRE( tree.size() == pts.size() );
+      REQUIRE( tree.point( 17 ) == pts[ 17 ] );
+      REQUIRE( tree.point( 4999 ) == pts[ 4999 ] );
+    }
+
+  SECTION( "kNearest and nearest are identical to brute force" )
+    {
+      unsigned int nbOk = 0;
+      std::vector<std::size_t> result;
+      for ( auto q : queries )
+        {
+          tree.kNearest( q, 10, result );
+          if ( ( result == bruteForce( pts, q, 10, 10.0 ) )
+               && ( tree.nearest( q ) == result.front() ) ) nbOk++;
+        }
+      REQUIRE( nbOk == queries.size() );
+    }
+
+  SECTION( "inBall is identical to brute force" )
+    {
+      unsigned int nbOk = 0;
+      std::vector<std::size_t> result;
+      for ( auto q : queries )
+        {
+          tree.inBall( q, 0.1, result );
+          if ( result == bruteForce( pts, q, pts.size(), 0.1 ) ) nbOk++;
+        }
+      REQUIRE( nbOk == queries.size() );
+    }
+
+  SECTION( "Batched queries are identical to single queries" )
+    {
+      std::vector< std::vector<std::size_t> > knn, balls;
+      tree.kNearest( queries, 7, knn );
+      tree.inBall( queries, 0.15, balls );
+      unsigned int nbOk = 0;
+      std::vector<std::size_t> r1, r2;
+      for ( std::size_t i = 0; i < queries.size(); ++i )
+        {
+          tree.kNearest( queries[ i ], 7, r1 );
+          tree.inBall( queries[ i ], 0.15, r2 );
+          if ( ( knn[ i ] == r1 ) && ( balls[ i ] == r2 ) ) nbOk++;
+        }
+      REQUIRE( nbOk == queries.size() );
+    }
+}
+
+TEST_CASE( "Testing KdTree on digital points with ties" )
+{
+  typedef Z2i::Point Point;
+  std::vector<Point> pts;
+  for ( int y = 0; y < 20; ++y )
+    for ( int x = 0; x < 20; ++x )
+      pts.push_back( Point( x, y ) );
+  KdTree<Point> tree( pts.begin(), pts.end() );
+  std::vector<std::size_t> result;
+  // 5 points at distance <= 1 from (5,5), 4 of them equidistant.
+  tree.kNearest( Point( 5, 5 ), 5, result );
+  REQUIRE( result == bruteForce( pts, Point( 5, 5 ), 5, 100.0 ) );
+  tree.inBall( Z2i::RealPoint( 0.5, 0.5 ), 0.75, result );
+  REQUIRE( result.size() == 4 );
+  tree.kNearest( Point( 0, 0 ), 1000, result );
+  REQUIRE( result.size() == pts.size() );
+}
+
+/** @ingroup Tests **/
@@ -34,6 +34,9 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
 #include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -101,6 +104,43 @@ bool testVoronoiCovarianceMeasure()
   trace.info() << "- vcm_r.row(0) = " << vcm_r.row( 0 ) << std::endl;
   trace.info() << "- vcm_r.row(1) = " << vcm_r.row( 1 ) << std::endl;
   trace.info() << "- vcm_r.row(2) = " << vcm_r.row( 2 ) << std::endl;
+
+  nbok += ( vcm.points().size() == 9 && vcm.matrices().size() == 9
+            && vcm.vcmMap().size() == 9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "#points == #matrices == #vcmMap == 9" << std::endl;
+  bool indexOk = vcm.index( Point( 20,20,15 ) ) < vcm.points().size()
+    && vcm.index( Point( 1,2,3 ) ) == vcm.points().size();
+  for ( VCM::Size i = 0; i < vcm.points().size(); ++i )
+    indexOk = indexOk && ( vcm.index( vcm.points()[ i ] ) == i )
+      && ( vcm.vcmMap().find( vcm.points()[ i ] )->second == vcm.matrices()[ i ] );
+  nbok += indexOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "index( points()[ i ] ) == i" << std::endl;
+  std::vector<Matrix> vcms;
+  vcm.measure( chi_r, vcm.points(), vcms );
+  bool batchOk = vcms.size() == vcm.points().size();
+  for ( VCM::Size i = 0; batchOk && i < vcms.size(); ++i )
+    batchOk = vcms[ i ] == vcm.measure( chi_r, vcm.points()[ i ] );
+  nbok += batchOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batched measure == measure" << std::endl;
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 1 );
+#endif
+  VCM vcm1( 5.0, 4.0, l2, false );
+  vcm1.init( pts.begin(), pts.end() );
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#endif
+  nbok += ( vcm1.matrices() == vcm.matrices() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "matrices do not depend on the number of threads" << std::endl;
   trace.endBlock();
   
   return nbok == nb;
@@ -36,7 +36,9 @@
 #include "DGtal/graph/CUndirectedSimpleGraph.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/CGraphVisitor.h"
+#include "DGtal/graph/EpochMarkSet.h"
 #include <set>
+#include <vector>
 #include <iterator>
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -136,10 +138,81 @@ void testBreadthFirstPropagation()
   board.saveEPS("testBreadthFirstPropagation.eps");
 }
 
+/**
+ * Checks that a visitor with an EpochMarkSet, reset for every seed,
+ * visits the same nodes in the same order as a new visitor per seed.
+ */
+bool testBreadthFirstVisitorReset()
+{
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::DigitalSet DigitalSet;
+  typedef Z2i::Object4_8 Object;
+  typedef DomainPointIndexer<Domain> Indexer;
+  typedef EpochMarkSet<Indexer> MarkSet;
+  typedef BreadthFirstVisitor<Object, set<Point> > Visitor;
+  typedef BreadthFirstVisitor<Object, MarkSet > ResetVisitor;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Bounded breadth-first traversals with reset()" );
+  Domain domain( Point( -20, -20 ), Point( 20, 20 ) );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( 0, 0 ), 15 );
+  Shapes<Domain>::removeNorm1Ball( shape_set, Point( 3, 2 ), 4 );
+  Object obj( Z2i::dt4_8, shape_set );
+
+  // Mark set alone.
+  MarkSet marks( ( Indexer( domain ) ) );
+  set<Point> ref;
+  bool ok = true;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Point p( rand() % 41 - 20, rand() % 41 - 20 );
+      switch ( rand() % 3 ) {
+      case 0: ok = ok && ( marks.insert( p ).second == ref.insert( p ).second ); break;
+      case 1: ok = ok && ( marks.erase( p ) == ref.erase( p ) ); break;
+      default: ok = ok && ( ( marks.find( p ) != marks.end() ) == ( ref.count( p ) == 1 ) );
+      }
+      if ( i % 500 == 499 ) { marks.clear(); ref.clear(); }
+    }
+  ok = ok && ( marks.size() == ref.size() )
+    && ( set<Point>( marks.begin(), marks.end() ) == ref );
+  nbok += ( ok && marks.isValid() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << marks << " as std::set" << std::endl;
+
+  // Visitors.
+  ResetVisitor visitor( obj, MarkSet( Indexer( domain ) ) );
+  const Visitor::Data radius = 6;
+  ok = true;
+  for ( DigitalSet::ConstIterator it = shape_set.begin(), itE = shape_set.end();
+        it != itE; ++it )
+    {
+      Visitor ref_visitor( obj, *it );
+      visitor.reset( *it );
+      while ( ! ref_visitor.finished() && ref_visitor.current().second <= radius )
+        {
+          ok = ok && ! visitor.finished() && ( visitor.current() == ref_visitor.current() );
+          ref_visitor.expand();
+          visitor.expand();
+        }
+      ok = ok && ( visitor.markedVertices().size() == ref_visitor.markedVertices().size() );
+      visitor.terminate();
+      ref_visitor.terminate();
+      ok = ok && ( visitor.visitedVertices().size() == ref_visitor.visitedVertices().size() );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same nodes as new visitors for "
+               << shape_set.size() << " seeds" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main( int /*argc*/, char** /*argv*/ )
 {
   testBreadthFirstPropagation();
-  return 0;
+  bool res = testBreadthFirstVisitorReset();
+  return res ? 0 : 1;
 }
 
 
@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBreadthFirstVisitor-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of many bounded-radius breadth-first traversals, with a
+ * new visitor per seed or with one visitor reset for every seed.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/EpochMarkSet.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking bounded breadth-first traversals.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Visits the ball of radius @a radius around every seed with @a
+ * visitor, which is reset for each seed.
+ * @return the total number of visited vertices.
+ */
+template <typename Visitor, typename VertexIterator>
+std::size_t visitWithReset( Visitor & visitor, VertexIterator b, VertexIterator e,
+                            typename Visitor::Data radius )
+{
+  std::size_t nb = 0;
+  for ( ; b != e; ++b )
+    {
+      visitor.reset( *b );
+      while ( ! visitor.finished() && visitor.current().second <= radius )
+        {
+          ++nb;
+          visitor.expand();
+        }
+    }
+  return nb;
+}
+
+/**
+ * Visits the ball of radius @a radius around every seed with a new
+ * visitor.
+ * @return the total number of visited vertices.
+ */
+template <typename Visitor, typename Graph, typename VertexIterator>
+std::size_t visitWithNewVisitors( const Graph & graph, VertexIterator b, VertexIterator e,
+                                  typename Visitor::Data radius )
+{
+  std::size_t nb = 0;
+  for ( ; b != e; ++b )
+    {
+      Visitor visitor( graph, *b );
+      while ( ! visitor.finished() && visitor.current().second <= radius )
+        {
+          ++nb;
+          visitor.expand();
+        }
+    }
+  return nb;
+}
+
+bool benchmarkBreadthFirstVisitor()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef Z3i::DigitalSet DigitalSet;
+  typedef Z3i::Object6_18 Object;
+
+  trace.beginBlock ( "Creating 3D ball and its border ..." );
+  Domain domain( Point( -50, -50, -50 ), Point( 50, 50, 50 ) );
+  DigitalSet ball_set( domain );
+  Shapes<Domain>::addNorm2Ball( ball_set, Point( 0, 0, 0 ), 49 );
+  Object sphere = Object( Z3i::dt6_18, ball_set ).border();
+  std::vector<Point> seeds( sphere.pointSet().begin(), sphere.pointSet().end() );
+  trace.info() << "sphere.size() = " << sphere.size() << std::endl;
+  trace.endBlock();
+
+  Clock c;
+  const std::size_t radius = 5;
+  trace.beginBlock ( "Bounded traversals on an Object (6-18 sphere)" );
+  typedef BreadthFirstVisitor<Object, std::set<Point> > Visitor;
+  c.startClock();
+  const std::size_t nb1 = visitWithNewVisitors<Visitor>( sphere, seeds.begin(), seeds.end(), radius );
+  const double t1 = c.stopClock();
+  typedef EpochMarkSet< DomainPointIndexer<Domain> > MarkSet;
+  typedef BreadthFirstVisitor<Object, MarkSet> ResetVisitor;
+  c.startClock();
+  ResetVisitor visitor( sphere, MarkSet( DomainPointIndexer<Domain>( domain ) ) );
+  const std::size_t nb2 = visitWithReset( visitor, seeds.begin(), seeds.end(), radius );
+  const double t2 = c.stopClock();
+  nbok += ( nb1 == nb2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << seeds.size() << " seeds, "
+               << nb1 << " visited vertices: new visitors " << t1 << " ms, "
+               << "reset visitor " << t2 << " ms." << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Bounded traversals on a DigitalSurface (ball boundary)" );
+  typedef DigitalSetBoundary<Z3i::KSpace, DigitalSet> Boundary;
+  typedef DigitalSurface<Boundary> MyDigitalSurface;
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  MyDigitalSurface surface( new Boundary( K, ball_set ) );
+  std::vector<Z3i::SCell> surfels( surface.begin(), surface.end() );
+  typedef BreadthFirstVisitor<MyDigitalSurface> SVisitor;
+  c.startClock();
+  const std::size_t nb3 = visitWithNewVisitors<SVisitor>( surface, surfels.begin(), surfels.end(), radius );
+  const double t3 = c.stopClock();
+  typedef EpochMarkSet< KSpaceSCellIndexer<Z3i::KSpace> > SMarkSet;
+  typedef BreadthFirstVisitor<MyDigitalSurface, SMarkSet> SResetVisitor;
+  c.startClock();
+  SResetVisitor svisitor( surface, SMarkSet( KSpaceSCellIndexer<Z3i::KSpace>( K ) ) );
+  const std::size_t nb4 = visitWithReset( svisitor, surfels.begin(), surfels.end(), radius );
+  const double t4 = c.stopClock();
+  nbok += ( nb3 == nb4 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << surfels.size() << " seeds, "
+               << nb3 << " visited surfels: new visitors " << t3 << " ms, "
+               << "reset visitor " << t4 << " ms." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking BreadthFirstVisitor with reset()" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkBreadthFirstVisitor();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 #include "DGtal/graph/CGraphVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/graph/EpochMarkSet.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/Color.h"
@@ -166,7 +167,36 @@ bool testDistancePropagation()
   trace.info() << "(" << nbperfect << "/" << nb 
                << ") number of vertices in perfect Euclidean distance ordering."<< std::endl;
   trace.endBlock();
-  return nb == nbok;
+
+  trace.beginBlock( "Distance visitor reset with a new distance." );
+  typedef EpochMarkSet< DomainPointIndexer<Domain> > MarkSet;
+  typedef DistanceBreadthFirstVisitor< Object, VertexFunctor, MarkSet > ResetVisitor;
+  ResetVisitor resetVisitor( obj, vfunctor, MarkSet( DomainPointIndexer<Domain>( domain ) ) );
+  unsigned int nbsame = 0;
+  unsigned int nbseeds = 0;
+  unsigned int i = 0;
+  for ( DigitalSet::ConstIterator it = shape_set.begin(), itE = shape_set.end();
+        it != itE; ++it )
+    {
+      if ( ( i++ % 5 ) != 0 ) continue;
+      VertexFunctor seedFunctor( embedder, std::bind1st( distance, embedder( *it ) ) );
+      Visitor refVisitor( obj, seedFunctor, *it );
+      resetVisitor.reset( seedFunctor, *it );
+      bool same = true;
+      while ( ! refVisitor.finished() && refVisitor.current().second <= 5.0 )
+        {
+          same = same && ! resetVisitor.finished()
+            && ( refVisitor.current() == resetVisitor.current() );
+          refVisitor.expand();
+          resetVisitor.expand();
+        }
+      nbsame += same ? 1 : 0;
+      ++nbseeds;
+    }
+  trace.info() << "(" << nbsame << "/" << nbseeds 
+               << ") seeds with the same traversal as a new visitor."<< std::endl;
+  trace.endBlock();
+  return ( nb == nbok ) && ( nbsame == nbseeds );
 }
 
 int main( int /*argc*/, char** /*argv*/ )
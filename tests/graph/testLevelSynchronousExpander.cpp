@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLevelSynchronousExpander.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class LevelSynchronousExpander.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/LevelSynchronousExpander.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class LevelSynchronousExpander.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the distances computed by @a expander with the ones of a
+ * BreadthFirstVisitor on @a object, from @a seeds, for every point
+ * of the domain and in the distance image.
+ */
+template <typename LSExpander, typename Object, typename PointIterator>
+bool checkDistances( const LSExpander & expander, const Object & object,
+                     PointIterator b, PointIterator e,
+                     typename LSExpander::Distance maxDistance )
+{
+  typedef typename Object::Point Point;
+  typedef typename LSExpander::Distance Distance;
+  typedef typename LSExpander::Domain::ConstIterator DomainConstIterator;
+  typedef BreadthFirstVisitor<Object, std::set<Point> > Visitor;
+  std::map<Point, Distance> distances;
+  Visitor visitor( object, b, e );
+  while ( ! visitor.finished() && visitor.current().second <= maxDistance )
+    {
+      distances[ visitor.current().first ] = (Distance) visitor.current().second;
+      visitor.expand();
+    }
+  if ( distances.size() != expander.nbVisited() )
+    {
+      trace.warning() << "nbVisited=" << expander.nbVisited()
+                      << " != " << distances.size() << std::endl;
+      return false;
+    }
+  typename LSExpander::DistanceImage image = expander.distanceImage();
+  unsigned int nbErrors = 0;
+  for ( DomainConstIterator it = expander.domain().begin(), itE = expander.domain().end();
+        it != itE; ++it )
+    {
+      typename std::map<Point, Distance>::const_iterator itD = distances.find( *it );
+      const Distance d = ( itD == distances.end() )
+        ? LSExpander::infiniteDistance() : itD->second;
+      if ( ( expander.distance( *it ) != d ) || ( image( *it ) != d ) )
+        ++nbErrors;
+    }
+  if ( nbErrors != 0 )
+    trace.warning() << nbErrors << " wrong distances." << std::endl;
+  return nbErrors == 0;
+}
+
+/**
+ * A ball with holes, the points x such that rand() hits a given
+ * fraction are removed.
+ */
+template <typename DigitalSet>
+void makePorousBall( DigitalSet & set, const typename DigitalSet::Point & center,
+                     int radius, unsigned int holePercent )
+{
+  typedef typename DigitalSet::Domain Domain;
+  Shapes<Domain>::addNorm2Ball( set, center, radius );
+  srand( 0 );
+  std::vector<typename DigitalSet::Point> holes;
+  for ( typename DigitalSet::ConstIterator it = set.begin(), itE = set.end();
+        it != itE; ++it )
+    if ( (unsigned int) ( rand() % 100 ) < holePercent )
+      holes.push_back( *it );
+  for ( unsigned int i = 0; i < holes.size(); ++i )
+    set.erase( holes[ i ] );
+}
+
+bool testLevelSynchronousExpander2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef LevelSynchronousExpander<Domain> LSExpander;
+
+  trace.beginBlock ( "Testing LevelSynchronousExpander in 2D ..." );
+  Domain domain( Point( -40, -30 ), Point( 45, 37 ) );
+  Z2i::DigitalSet set( domain );
+  makePorousBall( set, Point( 2, 3 ), 33, 25 );
+  std::vector<Point> seeds;
+  seeds.push_back( *set.begin() );
+  seeds.push_back( Point( 2, 3 ) );
+  seeds.push_back( Point( 100, 100 ) ); // outside the domain
+
+  Z2i::Object4_8 object4( Z2i::dt4_8, set );
+  Z2i::Object8_4 object8( Z2i::dt8_4, set );
+  LSExpander expander4( domain, 1 );
+  LSExpander expander8( domain, 2 );
+  expander4.setObject( set );
+  expander8.setObject( set );
+  trace.info() << expander4 << std::endl;
+  nbok += ( expander4.isValid() && expander4.size() == set.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "size() == set.size() = " << set.size() << std::endl;
+  // Top-down only, bottom-up only, switching.
+  const double alphas[ 3 ] = { 0.0, 1e9, 14.0 };
+  const double betas[ 3 ] = { 0.0, 0.0, 24.0 };
+  for ( unsigned int m = 0; m < 3; ++m )
+    {
+      expander4.setDirectionParameters( alphas[ m ], betas[ m ] );
+      expander8.setDirectionParameters( alphas[ m ], betas[ m ] );
+      expander4.expand( seeds.begin(), seeds.begin() + 1 );
+      nbok += checkDistances( expander4, object4, seeds.begin(), seeds.begin() + 1,
+                              LSExpander::infiniteDistance() ) ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "4-adjacency, one seed, alpha=" << alphas[ m ]
+                   << " " << expander4 << std::endl;
+      expander8.expand( seeds.begin(), seeds.end() );
+      nbok += checkDistances( expander8, object8, seeds.begin(), seeds.begin() + 2,
+                              LSExpander::infiniteDistance() ) ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "8-adjacency, two seeds, alpha=" << alphas[ m ]
+                   << " " << expander8 << std::endl;
+      expander4.expand( Point( 2, 3 ), 10 );
+      nbok += checkDistances( expander4, object4, seeds.begin() + 1, seeds.begin() + 2, 10 )
+        && ( expander4.nbLayers() <= 11 ) ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "4-adjacency, max distance 10, alpha=" << alphas[ m ]
+                   << " " << expander4 << std::endl;
+    }
+  nbok += ( expander4.expand( Point( 100, 100 ) ) == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no layer from a seed outside the domain" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testLevelSynchronousExpander3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef LevelSynchronousExpander<Domain> LSExpander;
+
+  trace.beginBlock ( "Testing LevelSynchronousExpander in 3D ..." );
+  Domain domain( Point( -17, -15, -16 ), Point( 16, 18, 17 ) );
+  Z3i::DigitalSet set( domain );
+  makePorousBall( set, Point( 0, 0, 0 ), 15, 40 );
+  std::vector<Point> seeds;
+  seeds.push_back( *set.begin() );
+  LSExpander expander6( domain, 1 );
+  LSExpander expander18( domain, 2 );
+  LSExpander expander26( domain, 3 );
+  expander6.setObject( set );
+  expander18.setObject( set );
+  expander26.setObject( set );
+  Z3i::Object6_18 object6( Z3i::dt6_18, set );
+  Z3i::Object18_6 object18( Z3i::dt18_6, set );
+  Z3i::Object26_6 object26( Z3i::dt26_6, set );
+  Clock c;
+  c.startClock();
+  expander6.expand( seeds.begin(), seeds.end() );
+  const double t = c.stopClock();
+  nbok += checkDistances( expander6, object6, seeds.begin(), seeds.end(),
+                          LSExpander::infiniteDistance() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "6-adjacency " << expander6 << " in " << t << " ms" << std::endl;
+  expander18.expand( seeds.begin(), seeds.end() );
+  nbok += checkDistances( expander18, object18, seeds.begin(), seeds.end(),
+                          LSExpander::infiniteDistance() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "18-adjacency " << expander18 << std::endl;
+  expander26.expand( seeds.begin(), seeds.end() );
+  nbok += checkDistances( expander26, object26, seeds.begin(), seeds.end(),
+                          LSExpander::infiniteDistance() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "26-adjacency " << expander26 << std::endl;
+  nbok += ( expander18.nbBottomUpLayers() > 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "direction switch used bottom-up layers" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class LevelSynchronousExpander" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testLevelSynchronousExpander2D()
+    && testLevelSynchronousExpander3D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
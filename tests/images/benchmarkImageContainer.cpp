@@ -163,6 +163,47 @@ BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
 
 
+/// A piecewise constant image (concentric rings) of size n^2.
+ImageVector2 ConstructRings(unsigned int n) {
+  ImageVector2 rings( Z2i::Domain( Z2i::Point().diagonal(0), Z2i::Point().diagonal(n - 1) ) );
+  for(Z2i::Domain::ConstIterator it = rings.domain().begin(), itend = rings.domain().end();
+      it != itend; ++it)
+    rings.setValue( *it, (DGtal::int32_t) ( ( *it - Z2i::Point( n / 2, n / 3 ) ).norm() / 16.0 ) % 4 );
+  return rings;
+}
+
+void Fill(ImageVector2 & image, const ImageVector2 & source) { image = source; }
+void Fill(ImageHash2 & image, const ImageVector2 & source) { image.build( source ); }
+
+template<typename Q>
+static void BM_Build(benchmark::State& state)
+{
+  const ImageVector2 rings = ConstructRings( state.range(0) );
+  while (state.KeepRunning())
+    {
+      Q image( rings.domain() );
+      Fill( image, rings );
+    }
+  state.SetItemsProcessed(state.iterations() * rings.domain().size());
+}
+BENCHMARK_TEMPLATE(BM_Build, ImageVector2)->Range(1<<6 , 1 << 11);
+BENCHMARK_TEMPLATE(BM_Build, ImageHash2)->Range(1<<6 , 1 << 11);
+
+template<typename Q>
+static void BM_GetValue(benchmark::State& state)
+{
+  const ImageVector2 rings = ConstructRings( state.range(0) );
+  Q image( rings.domain() );
+  Fill( image, rings );
+  DGtal::int64_t sum = 0;
+  while (state.KeepRunning())
+    for(typename Q::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+        it != itend; ++it)
+      benchmark::DoNotOptimize( sum += image( *it ) );
+  state.SetItemsProcessed(state.iterations() * rings.domain().size());
+}
+BENCHMARK_TEMPLATE(BM_GetValue, ImageVector2)->Range(1<<6 , 1 << 11);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageHash2)->Range(1<<6 , 1 << 11);
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -281,6 +281,80 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Random setValue calls, bulk build and leaf cache against a vector image.
+ */
+bool testBuildAndUpdates()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> ImageVector;
+
+  trace.beginBlock ( "Random updates" );
+  Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 20, 14, 31 ) );
+  Image image( domain, 2, 0 );
+  ImageVector reference( domain );
+  std::fill( reference.begin(), reference.end(), 0 );
+  srand( 0 );
+  bool ok = true;
+  for ( unsigned int k = 0; k < 20; ++k )
+    {
+      // blocks of random values, then random points
+      Z3i::Point p;
+      for ( unsigned int i = 0; i < 2000; ++i )
+        {
+          for ( Dimension n = 0; n < 3; ++n )
+            p[ n ] = domain.lowerBound()[ n ]
+              + rand() % ( domain.upperBound()[ n ] - domain.lowerBound()[ n ] + 1 );
+          const int v = ( k % 2 == 0 ) ? ( p[ 0 ] / 4 + p[ 1 ] / 8 ) % 3 : rand() % 3;
+          image.setValue( p, v );
+          reference.setValue( p, v );
+        }
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        ok = ok && ( image( *it ) == reference( *it ) );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "setValue/operator() consistent with a vector image, "
+               << image.getNbNodes() << " nodes, max collisions "
+               << image.getMaxCollisions() << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Bulk build" );
+  Image built( domain, 2, -1 );
+  built.build( reference );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    ok = ok && ( built( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "built tree consistent with the vector image, "
+               << built.getNbNodes() << " nodes" << std::endl;
+  unsigned int nbLeaves = 0;
+  for ( Image::Iterator it = built.begin(), itE = built.end(); it != itE; ++it )
+    ++nbLeaves;
+  nbok += ( nbLeaves == built.getNbNodes() && built.getNbNodes() <= image.getNbNodes() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "iterator visits the " << nbLeaves << " leaves" << std::endl;
+
+  ImageVector uniform( domain );
+  std::fill( uniform.begin(), uniform.end(), 7 );
+  built.build( uniform );
+  nbok += ( built.getNbNodes() == 1 && built( domain.upperBound() ) == 7 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "uniform image gives a single leaf" << std::endl;
+
+  const Image::HashKey key = built.getKey( Z3i::Point( 5, 7, 11 ) );
+  int* coordinates = built.getCoordinatesFromKey( key );
+  nbok += ( coordinates[ 0 ] == 8 && coordinates[ 1 ] == 5 && coordinates[ 2 ] == 11 ) ? 1 : 0; nb++;
+  delete[] coordinates;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "getCoordinatesFromKey inverts getKey" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -292,7 +366,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testBuildAndUpdates();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
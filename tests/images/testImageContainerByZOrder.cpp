@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByZOrder.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageContainerByZOrder.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByZOrder.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByZOrder.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills a Z-order image and a vector image with the same values, and
+ * compares their values, ranges and storage positions.
+ */
+template <typename Domain>
+bool testImageContainerByZOrder( const Domain & domain, unsigned int brickLogSize )
+{
+  typedef ImageContainerByZOrder<Domain, int> Image;
+  typedef ImageContainerBySTLVector<Domain, int> VectorImage;
+  typedef typename Domain::Point Point;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Image image( domain, -1, brickLogSize );
+  VectorImage reference( domain );
+  int v = 0;
+  for ( typename Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it, ++v )
+    {
+      image.setValue( *it, 3 * v + 1 );
+      reference.setValue( *it, 3 * v + 1 );
+    }
+  trace.info() << image << std::endl;
+  nbok += ( image.isValid() && std::equal( reference.constRange().begin(), reference.constRange().end(),
+                                           image.constRange().begin() ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values as ImageContainerBySTLVector in domain order" << std::endl;
+
+  std::vector<bool> used( image.storageSize(), false );
+  bool okIndex = true;
+  for ( typename Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const typename Image::Index i = image.index( *it );
+      okIndex = okIndex && ( i < image.storageSize() ) && ! used[ i ]
+        && ( image.point( i ) == *it ) && ( image[ i ] == reference( *it ) );
+      used[ i ] = true;
+    }
+  nbok += okIndex ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "index and point are inverse, storage size " << image.storageSize()
+               << " for " << domain.size() << " points" << std::endl;
+
+  // The 2^d points of an aligned cube of side 2 are consecutive.
+  Point corner = domain.lowerBound();
+  std::vector<typename Image::Index> cube;
+  for ( unsigned int k = 0; k < ( 1u << Domain::dimension ); ++k )
+    {
+      Point p = corner;
+      for ( Dimension n = 0; n < Domain::dimension; ++n )
+        p[ n ] += ( k >> n ) & 1;
+      cube.push_back( image.index( p ) );
+    }
+  std::sort( cube.begin(), cube.end() );
+  nbok += ( cube.back() - cube.front() + 1 == cube.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "neighbors are consecutive in memory" << std::endl;
+
+  Image copy( domain, 0, brickLogSize );
+  std::copy( reference.constRange().begin(), reference.constRange().end(), copy.outputIterator() );
+  typename Image::Range::ConstIterator itC = copy.range().begin();
+  nbok += ( *itC == 1 && copy( domain.upperBound() ) == reference( domain.upperBound() ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "output iterator and range" << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Sums the 6 neighbors of each point of a 3D image.
+ */
+template <typename Image>
+double neighborhoodSum( const Image & image, DGtal::int64_t & sum )
+{
+  typedef typename Image::Domain::Point Point;
+  const Point lower = image.domain().lowerBound() + Point::diagonal( 1 );
+  const Point upper = image.domain().upperBound() - Point::diagonal( 1 );
+  Clock c;
+  c.startClock();
+  sum = 0;
+  Point p;
+  for ( p[ 0 ] = lower[ 0 ]; p[ 0 ] <= upper[ 0 ]; ++p[ 0 ] )
+    for ( p[ 1 ] = lower[ 1 ]; p[ 1 ] <= upper[ 1 ]; ++p[ 1 ] )
+      for ( p[ 2 ] = lower[ 2 ]; p[ 2 ] <= upper[ 2 ]; ++p[ 2 ] )
+        for ( Dimension n = 0; n < 3; ++n )
+          {
+            Point q = p;
+            q[ n ] -= 1;
+            sum += image( q );
+            q[ n ] += 2;
+            sum += image( q );
+          }
+  return c.stopClock();
+}
+
+bool testImageContainerByZOrder()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ImageContainerByZOrder in 2D ..." );
+  nbok += testImageContainerByZOrder( Z2i::Domain( Z2i::Point( -7, 3 ), Z2i::Point( 40, 21 ) ), 0 ) ? 1 : 0; nb++;
+  nbok += testImageContainerByZOrder( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 16, 16 ) ), 2 ) ? 1 : 0; nb++;
+  trace.endBlock();
+  trace.beginBlock ( "Testing ImageContainerByZOrder in 3D ..." );
+  nbok += testImageContainerByZOrder( Z3i::Domain( Z3i::Point( -5, -6, 2 ), Z3i::Point( 12, 20, 9 ) ), 0 ) ? 1 : 0; nb++;
+  nbok += testImageContainerByZOrder( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 31, 31 ) ), 5 ) ? 1 : 0; nb++;
+  trace.endBlock();
+
+  trace.beginBlock ( "Comparing neighborhood accesses ..." );
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 63 ) );
+  ImageContainerByZOrder<Z3i::Domain, int> zimage( domain, 1 );
+  ImageContainerBySTLVector<Z3i::Domain, int> vimage( domain );
+  std::fill( vimage.begin(), vimage.end(), 1 );
+  DGtal::int64_t zsum, vsum;
+  const double vt = neighborhoodSum( vimage, vsum );
+  const double zt = neighborhoodSum( zimage, zsum );
+  trace.info() << "z-order " << zt << " ms, vector " << vt << " ms" << std::endl;
+  nbok += ( zsum == vsum ) ? 1 : 0; nb++;
+  trace.endBlock();
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByZOrder" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageContainerByZOrder();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
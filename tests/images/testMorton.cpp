@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,60 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Compares the Morton codes with a bit by bit interleaving, and
+ * checks that coordinatesFromKey inverts keyFromCoordinates.
+ */
+template <typename HashKey, typename Point>
+bool testMortonCodec( unsigned int nbPoints )
+{
+  typedef typename Point::Coordinate Coordinate;
+  const unsigned int dimension = Point::dimension;
+  const unsigned int nbBits = ( sizeof( HashKey ) * 8 ) / dimension;
+  const unsigned int depth = std::min( nbBits - 1, 15u );
+  Morton<HashKey,Point> morton;
+  unsigned int nbErrors = 0;
+  srand( 0 );
+  for ( unsigned int k = 0; k < nbPoints; ++k )
+    {
+      Point p;
+      for ( unsigned int n = 0; n < dimension; ++n )
+        p[ n ] = static_cast<Coordinate>( rand() % ( 1 << depth ) );
+      HashKey expected = 0;
+      for ( unsigned int i = 0; i < nbBits; ++i )
+        for ( unsigned int n = 0; n < dimension; ++n )
+          if ( ( static_cast<HashKey>( p[ n ] ) >> i ) & 1 )
+            expected |= static_cast<HashKey>( 1 ) << ( i * dimension + n );
+      HashKey h;
+      morton.interleaveBits( p, h );
+      Point q;
+      morton.coordinatesFromKey( morton.keyFromCoordinates( depth, p ), q );
+      if ( h != expected || p != q
+           || morton.contract( morton.dilate( static_cast<HashKey>( p[ 0 ] ) ) ) 
+              != static_cast<HashKey>( p[ 0 ] ) )
+        ++nbErrors;
+    }
+  trace.info() << "dimension " << dimension << ", " << sizeof( HashKey ) * 8
+               << " bits keys: " << nbErrors << " errors" << std::endl;
+  return nbErrors == 0;
+}
+
+bool testMortonCodecs()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Morton dilation and contraction ..." );
+  nbok += testMortonCodec< DGtal::uint64_t, PointVector<2,DGtal::int32_t> >( 10000 ) ? 1 : 0; nb++;
+  nbok += testMortonCodec< DGtal::uint64_t, PointVector<3,DGtal::int32_t> >( 10000 ) ? 1 : 0; nb++;
+  nbok += testMortonCodec< DGtal::uint64_t, PointVector<4,DGtal::int32_t> >( 10000 ) ? 1 : 0; nb++;
+  nbok += testMortonCodec< DGtal::uint32_t, PointVector<3,DGtal::int32_t> >( 10000 ) ? 1 : 0; nb++;
+  nbok += testMortonCodec< DGtal::uint64_t, PointVector<1,DGtal::int64_t> >( 10000 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "codes equal to bit by bit interleaving" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +187,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton() && testMortonCodecs(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -123,6 +123,20 @@ bool testMeshReader()
 	       << "true == true" << std::endl;
   trace.endBlock();  
 
+  trace.beginBlock ( "Testing OFF import with face colors ..." );
+  Mesh<Point> a3DMesh3(true);
+  MeshReader<Point>::importOFFFile(filenameOFF, a3DMesh3, true);
+  nb++;
+  Mesh<Point>::ConstFaceView aFace3 = a3DMesh3.getFace(1);
+  bool isWellImported3 = (a3DMesh3.nbVertex()==8) && (a3DMesh3.nbFaces()==6)
+    && (a3DMesh3.faceIndices().size()==24) && (a3DMesh3.getVertex(7)[2]==-1.154701)
+    && (aFace3.size()==4) && (aFace3[0]==3) && (aFace3[3]==7)
+    && (a3DMesh3.getFaceColor(1)==DGtal::Color(76, 102, 0, 191));
+  nbok+=isWellImported3? 1: 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "colors and inverted faces are imported" << std::endl;
+  trace.endBlock();  
+
   
   
 
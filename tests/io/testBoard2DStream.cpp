@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoard2DStream.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the streaming mode and the rasters of Board2D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/boards/Board2D.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the streaming mode of Board2D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the number of occurrences of a pattern in a string.
+ */
+unsigned int count( const std::string & text, const std::string & pattern )
+{
+  unsigned int n = 0;
+  for ( std::string::size_type i = text.find( pattern ); i != std::string::npos;
+        i = text.find( pattern, i + pattern.size() ) )
+    ++n;
+  return n;
+}
+
+/**
+ * Draws shapes that cannot be merged.
+ */
+void drawShapes( Board2D & board )
+{
+  board.setUnit( LibBoard::Board::UPoint );
+  board.setPenColor( Color::Black );
+  board.drawRectangle( -1, 1, 2.0, 2.0 );
+  board.drawRectangle( 1, 1, 2.0, 2.0 );
+  board.setPenColor( Color::Blue );
+  board.fillCircle( 2, 2, 1 );
+  board.drawLine( -1, -1, 3, 2 );
+  static_cast<LibBoard::Board &>( board ) << LibBoard::Ellipse( 0, 0, 1.5, 0.5, Color::Red, Color::None, 0.5 );
+}
+
+bool testStream()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing the streaming mode ..." );
+
+  Board2D board;
+  drawShapes( board );
+  std::ostringstream saved;
+  board.saveSVG( saved );
+
+  Board2D streamed;
+  std::ostringstream stream;
+  streamed.setUnit( LibBoard::Board::UPoint );
+  streamed.beginStream( stream, Board2D::StreamSVG, board.boundingBox() );
+  drawShapes( streamed );
+  const bool streaming = streamed.isStreaming();
+  streamed.endStream();
+
+  nbok += ( streaming && ! streamed.isStreaming() && stream.str() == saved.str() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "streamed SVG == saved SVG" << std::endl;
+
+  // Pixels of the same color in a row are merged.
+  const Domain domain( Point( 0, 0 ), Point( 63, 47 ) );
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, static_cast<unsigned char>( 32 * ( (*it)[0] / 8 ) ) );
+
+  Board2D pixels;
+  std::ostringstream svg;
+  pixels.beginStream( svg, Board2D::StreamSVG,
+                      LibBoard::Rect( -0.5, 47.5, 64, 48 ) );
+  pixels.setPenColor( Color::None );
+  Display2DFactory::drawImage< GrayscaleColorMap<unsigned char> >( pixels, image, 0, 255 );
+  pixels.endStream();
+  trace.info() << svg.str().size() << " bytes" << std::endl;
+
+  nbok += ( count( svg.str(), "<rect" ) == 48 * 8 && pixels.boundingBox().width == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "runs of pixels: " << count( svg.str(), "<rect" ) << " rectangles" << std::endl;
+
+  // With a visible outline, pixels are not merged.
+  Board2D outlined;
+  std::ostringstream eps;
+  outlined.beginStream( eps, Board2D::StreamEPS,
+                        LibBoard::Rect( -0.5, 47.5, 64, 48 ) );
+  outlined.setPenColor( Color::Red );
+  Display2DFactory::drawImage< GrayscaleColorMap<unsigned char> >( outlined, image, 0, 255 );
+  outlined.endStream();
+
+  nbok += ( count( eps.str(), "% Polyline" ) == 64 * 48 && count( eps.str(), "%%Trailer" ) == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "outlined pixels are kept" << std::endl;
+
+  // A board destroyed while streaming writes the trailer.
+  std::ostringstream unfinished;
+  {
+    Board2D streaming;
+    streaming.beginStream( unfinished, Board2D::StreamSVG, board.boundingBox() );
+    drawShapes( streaming );
+  }
+  nbok += ( count( unfinished.str(), "</svg>" ) == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "the destructor ends the streaming mode" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testRaster()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing rasters ..." );
+
+  const Domain domain( Point( -10, -5 ), Point( 29, 14 ) );
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, static_cast<unsigned char>( 10 * ( (*it)[0] + 10 ) ) );
+
+  Board2D board;
+  board.setUnit( LibBoard::Board::UPoint );
+  Display2DFactory::drawImageAsRaster< GrayscaleColorMap<unsigned char> >( board, image, 0, 255 );
+  LibBoard::Rect box = board.boundingBox();
+  nbok += ( box.left == -10.5 && box.top == 14.5 && box.width == 40 && box.height == 20 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "raster bounding box " << box << std::endl;
+
+  std::ostringstream svg;
+  board.saveSVG( svg );
+  nbok += ( count( svg.str(), "<image" ) == 1 && count( svg.str(), "<rect" ) == 0
+            && count( svg.str(), "xlink:href=\"data:image/png;base64,iVBORw0KGgo" ) == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "SVG embeds a PNG image (" << svg.str().size() << " bytes)" << std::endl;
+
+  std::ostringstream eps;
+  board.saveEPS( eps );
+  nbok += ( count( eps.str(), "40 20 8 [40 0 0 -20 0 20]" ) == 1
+            && count( eps.str(), "colorimage" ) == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "EPS embeds a colorimage" << std::endl;
+
+  // Formats without images get one polygon per run of pixels.
+  std::ostringstream fig;
+  board.saveFIG( fig );
+  nbok += ( count( fig.str(), "\n2 3 " ) == 40 * 20 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FIG falls back to runs of pixels" << std::endl;
+
+  // colorimage has no alpha channel: transparent pixels are skipped.
+  std::vector<Color> pixels( 4 * 3, Color::Red );
+  pixels[ 5 ] = Color( 0, 0, 255, 0 );
+  Board2D transparent;
+  transparent.setUnit( LibBoard::Board::UPoint );
+  transparent.drawRaster( 0, 3, 4, 3, 4, 3, pixels );
+  std::ostringstream transparentEPS;
+  transparent.saveEPS( transparentEPS );
+  nbok += ( count( transparentEPS.str(), "colorimage" ) == 0
+            && count( transparentEPS.str(), "% Polyline" ) == 4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "EPS falls back to runs of pixels when some are transparent" << std::endl;
+
+  board.saveSVG( "board2DRaster.svg" );
+  board.saveEPS( "board2DRaster.eps" );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing the streaming mode and the rasters of Board2D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testStream() && testRaster(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPrimitiveStore3D.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PrimitiveStore3D and the bulk insertions
+ * of Display3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/PrimitiveStore3D.h"
+#include "DGtal/io/boards/Board3D.h"
+#include "DGtal/shapes/Mesh.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef Mesh<RealPoint> RealMesh;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PrimitiveStore3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return true if both meshes have the same vertices (up to float
+ * precision), faces and face colors.
+ */
+bool sameMeshes( const RealMesh & m1, const RealMesh & m2 )
+{
+  if ( m1.nbVertex() != m2.nbVertex() || m1.nbFaces() != m2.nbFaces() )
+    return false;
+  for ( unsigned int i = 0; i < m1.nbVertex(); ++i )
+    if ( ( m1.getVertex( i ) - m2.getVertex( i ) ).norm() > 1e-5 )
+      return false;
+  for ( unsigned int f = 0; f < m1.nbFaces(); ++f )
+    {
+      RealMesh::ConstFaceView face1 = m1.getFace( f );
+      RealMesh::ConstFaceView face2 = m2.getFace( f );
+      if ( face1.size() != face2.size() || m1.getFaceColor( f ) != m2.getFaceColor( f ) )
+        return false;
+      for ( unsigned int k = 0; k < face1.size(); ++k )
+        if ( face1[ k ] != face2[ k ] ) return false;
+    }
+  return true;
+}
+
+bool testStore()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing PrimitiveStore3D ..." );
+
+  PrimitiveStore3D store;
+  store.add( 1, 1.0, 0, 0, 0, PrimitiveStore3D::CUBE, Color::Red );
+  store.add( 1, 1.0, 1, 0, 0, PrimitiveStore3D::CUBE, Color::Red );
+  store.add( 1, 1.0, 2, 0, 0, PrimitiveStore3D::QUAD_Z, Color::Blue );
+  store.add( 2, 1.0, 3, 0, 0, PrimitiveStore3D::CUBE, Color::Red );
+  store.add( 2, 0.5, 4, 0, 0, PrimitiveStore3D::CUBE, Color::Red );
+  store.add( 1, 1.0, 5, 0, 0, PrimitiveStore3D::QUAD_X, Color::Green );
+  trace.info() << store << std::endl;
+
+  nbok += ( store.size() == 6 && store.lists().size() == 4 && store.palette().size() == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "runs are split by name and width, colors are shared" << std::endl;
+
+  nbok += ( store.color( 3 ) == Color::Red && store.colorIndex( 0 ) == store.colorIndex( 4 )
+            && store.shape( 5 ) == PrimitiveStore3D::QUAD_X && store.position( 4 )[ 0 ] == 4.f ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "primitives are read back" << std::endl;
+
+  // Removing list 2 merges the runs of list 1 around it.
+  const bool erased = store.erase( 2 ) && ! store.erase( 2 );
+  nbok += ( erased && store.isValid() && store.size() == 4 && store.lists().size() == 1
+            && ! store.contains( 2 ) && store.position( 3 )[ 0 ] == 5.f
+            && store.color( 3 ) == Color::Green ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "erase compacts the store" << std::endl;
+
+  // List 1 holds two cubes and two squares: only the squares are removed.
+  const bool erasedQuads = store.eraseQuads( 1 ) && ! store.eraseQuads( 1 );
+  nbok += ( erasedQuads && store.isValid() && store.size() == 2 && store.lists().size() == 1
+            && store.contains( 1 ) && store.shape( 1 ) == PrimitiveStore3D::CUBE
+            && store.position( 1 )[ 0 ] == 1.f && ! store.eraseCubes( 2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "eraseQuads keeps the cubes of the list" << std::endl;
+
+  // Each face of the unit cube is counterclockwise seen from outside.
+  bool outward = true;
+  for ( unsigned int f = 0; f < PrimitiveStore3D::nbFaces( PrimitiveStore3D::CUBE ); ++f )
+    {
+      const unsigned int* face = PrimitiveStore3D::face( PrimitiveStore3D::CUBE, f );
+      RealPoint p[ 4 ];
+      for ( unsigned int k = 0; k < 4; ++k )
+        {
+          const float* v = PrimitiveStore3D::vertex( PrimitiveStore3D::CUBE, face[ k ] );
+          p[ k ] = RealPoint( v[ 0 ], v[ 1 ], v[ 2 ] );
+        }
+      const RealPoint normal = ( p[ 1 ] - p[ 0 ] ).crossProduct( p[ 2 ] - p[ 1 ] );
+      outward = outward && normal.dot( p[ 0 ] + p[ 2 ] ) > 0;
+    }
+  nbok += outward ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "unit cube faces are oriented outward" << std::endl;
+
+  store.clear();
+  nbok += ( store.empty() && store.lists().empty() && store.palette().empty() && store.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "clear" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testBulkInsertions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Display3D bulk insertions ..." );
+
+  const Domain domain( Point( -6, -6, -6 ), Point( 6, 6, 6 ) );
+  DigitalSet ball( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( *it ).norm() <= 5 ) ball.insertNew( *it );
+
+  KSpace kspace;
+  kspace.init( domain.lowerBound(), domain.upperBound(), true );
+  std::vector<SCell> surfels;
+  for ( DigitalSet::ConstIterator it = ball.begin(); it != ball.end(); ++it )
+    for ( Dimension k = 0; k < 3; ++k )
+      for ( int sign = -1; sign <= 1; sign += 2 )
+        {
+          Point neighbor = *it;
+          neighbor[ k ] += sign;
+          if ( ball( neighbor ) ) continue;
+          Point coords = 2 * ( *it ) + Point::diagonal( 1 );
+          coords[ k ] += sign;
+          surfels.push_back( kspace.sCell( coords, KSpace::POS ) );
+        }
+  trace.info() << ball.size() << " voxels, " << surfels.size() << " surfels" << std::endl;
+
+  // Reference scene, through the per-primitive insertions.
+  Board3D<Space, KSpace> reference( kspace );
+  reference.setFillColor( Color::Red );
+  for ( DigitalSet::ConstIterator it = ball.begin(); it != ball.end(); ++it )
+    reference.addCube( reference.embed( *it ) );
+  RealMesh referenceCubes( true );
+  reference.exportToMesh( referenceCubes );
+
+  reference.clear();
+  reference.setFillColor( Color::Blue );
+  for ( std::vector<SCell>::const_iterator it = surfels.begin(); it != surfels.end(); ++it )
+    {
+      // Same as Display3DFactory::drawOrientedSurfelWithNormal.
+      const Dimension orth = kspace.sOrthDir( *it );
+      RealPoint center = reference.embedKS( *it );
+      center[ orth ] += 0.5;
+      reference.addQuadFromSurfelCenter( center, orth == 0, orth == 1, orth == 2 );
+    }
+  RealMesh referenceSurfels( true );
+  reference.exportToMesh( referenceSurfels );
+
+  // Same scenes, through the primitive store.
+  Board3D<Space, KSpace> board( kspace );
+  board.setFillColor( Color::Red );
+  board.addCubes( ball.begin(), ball.end() );
+  RealMesh cubes( true );
+  board.exportToMesh( cubes );
+
+  nbok += ( board.primitiveStore().size() == ball.size() && sameMeshes( cubes, referenceCubes ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "addCubes exports as addCube: " << cubes.nbFaces() << " faces" << std::endl;
+
+  board.clear();
+  board.setFillColor( Color::Blue );
+  board.addSurfels( surfels.begin(), surfels.end() );
+  RealMesh quads( true );
+  board.exportToMesh( quads );
+
+  nbok += ( board.primitiveStore().size() == surfels.size() && sameMeshes( quads, referenceSurfels ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "addSurfels exports as addQuadFromSurfelCenter: " << quads.nbFaces() << " faces" << std::endl;
+
+  // Lists of the store are named and removed as the other cube lists.
+  board.clear();
+  board.createNewCubeList();
+  const DGtal::int32_t cubesName = board.name3d();
+  board.addCubes( ball.begin(), ball.end() );
+  const DGtal::int32_t surfelsName = board.createNewQuadList();
+  board.addSurfels( surfels.begin(), surfels.end() );
+  trace.info() << board.primitiveStore() << std::endl;
+  const bool named = cubesName != surfelsName && board.primitiveStore().lists().size() == 2;
+  board.deleteCubeList( cubesName );
+  nbok += ( named && board.primitiveStore().size() == surfels.size()
+            && board.primitiveStore().palette().size() == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "deleteCubeList removes the store list" << std::endl;
+
+  // Cubes and surfels added under the same name are deleted separately.
+  board.clear();
+  const DGtal::int32_t sharedName = board.createNewCubeList();
+  board.addCubes( ball.begin(), ball.end() );
+  board.addSurfels( surfels.begin(), surfels.end() );
+  const bool shared = board.primitiveStore().lists().size() == 1
+    && board.primitiveStore().size() == ball.size() + surfels.size();
+  board.deleteQuadList( sharedName );
+  const bool cubesKept = board.primitiveStore().size() == ball.size()
+    && board.primitiveStore().shape( 0 ) == PrimitiveStore3D::CUBE;
+  board.deleteCubeList( sharedName );
+  nbok += ( shared && cubesKept && board.primitiveStore().empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "deleteQuadList keeps the cubes of the same list" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PrimitiveStore3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testStore() && testBulkInsertions(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
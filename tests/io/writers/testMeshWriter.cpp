@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
+#include <cstring>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h" 
 //! [MeshWriterUseIncludes]
@@ -107,6 +109,95 @@ bool testMeshWriter()
   return nbok == nb;
 }
 
+/**
+ * Exports a mesh in binary and ASCII PLY, and reads back the binary
+ * data.
+ */
+bool testPLYWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing PLY export ..." );
+  typedef Z3i::RealPoint RealPoint;
+  Mesh<RealPoint> aMesh(true);
+  aMesh.addVertex( RealPoint( 0.5, 0, 0 ) );
+  aMesh.addVertex( RealPoint( 1, -0.25, 0 ) );
+  aMesh.addVertex( RealPoint( 1, 1, 0 ) );
+  aMesh.addVertex( RealPoint( 0, 1, 3 ) );
+  aMesh.addTriangularFace( 0, 1, 2, DGtal::Color( 250, 10, 0, 200 ) );
+  aMesh.addQuadFace( 0, 1, 2, 3, DGtal::Color( 1, 2, 3, 4 ) );
+
+  std::stringstream ss;
+  nbok += MeshWriter<RealPoint>::export2PLY( ss, aMesh ) ? 1 : 0; nb++;
+  std::string data = ss.str();
+  const std::string endHeader = "end_header\n";
+  const std::size_t start = data.find( endHeader ) + endHeader.size();
+  nbok += ( data.find( "format binary_little_endian 1.0" ) != std::string::npos )
+    && ( data.find( "element vertex 4" ) != std::string::npos )
+    && ( data.find( "element face 2" ) != std::string::npos )
+    && ( data.find( "property uchar alpha" ) != std::string::npos ) ? 1 : 0; nb++;
+  // 4 vertices * 3 floats, 2 faces with (1 + 4*n + 4) bytes.
+  nbok += ( data.size() - start == 4 * 12 + ( 1 + 12 + 4 ) + ( 1 + 16 + 4 ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "binary PLY header and size" << std::endl;
+  const unsigned char * bytes = (const unsigned char *) data.data() + start;
+  float y1;
+  DGtal::uint32_t bits = bytes[ 16 ] | ( bytes[ 17 ] << 8 ) | ( bytes[ 18 ] << 16 )
+    | ( (DGtal::uint32_t) bytes[ 19 ] << 24 );
+  std::memcpy( &y1, &bits, 4 );
+  const unsigned char * face1 = bytes + 48 + 17;
+  nbok += ( y1 == -0.25f ) && ( bytes[ 48 ] == 3 ) && ( bytes[ 48 + 5 ] == 1 )
+    && ( face1[ 0 ] == 4 ) && ( face1[ 13 ] == 3 ) && ( face1[ 17 ] == 1 )
+    && ( face1[ 20 ] == 4 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "binary PLY data (little endian)" << std::endl;
+
+  std::stringstream ssa;
+  nbok += MeshWriter<RealPoint>::export2PLY( ssa, aMesh, false, false ) ? 1 : 0; nb++;
+  nbok += ( ssa.str().find( "format ascii 1.0" ) != std::string::npos )
+    && ( ssa.str().find( "property uchar red" ) == std::string::npos )
+    && ( ssa.str().find( "\n4 0 1 2 3\n" ) != std::string::npos ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ASCII PLY without colors" << std::endl;
+  nbok += ( aMesh >> "test.ply" ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "aMesh >> test.ply" << std::endl;
+
+  // Both formats reject faces of more than 255 vertices and bad streams.
+  Mesh<RealPoint> bigFaceMesh;
+  Mesh<RealPoint>::MeshFace bigFace;
+  for ( unsigned int i = 0; i < 256; ++i )
+    {
+      bigFaceMesh.addVertex( RealPoint( i, i * i, 0 ) );
+      bigFace.push_back( i );
+    }
+  bigFaceMesh.addFace( bigFace );
+  bool ok = true;
+  for ( unsigned int binary = 0; binary < 2; ++binary )
+    {
+      try
+        {
+          std::stringstream sb;
+          MeshWriter<RealPoint>::export2PLY( sb, bigFaceMesh, binary == 1 );
+          ok = false;
+        }
+      catch ( DGtal::IOException & ) {}
+      try
+        {
+          std::stringstream bad;
+          bad.setstate( std::ios::badbit );
+          MeshWriter<RealPoint>::export2PLY( bad, aMesh, binary == 1 );
+          ok = false;
+        }
+      catch ( DGtal::IOException & ) {}
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "binary and ASCII PLY check face sizes and the stream" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -118,7 +209,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshWriter(); // && ... other tests
+  bool res = testMeshWriter() && testPLYWriter(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
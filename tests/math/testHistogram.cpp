@@ -109,6 +109,68 @@ bool testHistogramGaussian2()
   return nbok == nb;
 }
 
+bool testHistogramChunks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  std::vector<double> values;
+  for(unsigned int k=0; k < 10000; k++)
+    values.push_back( getRandomNumber( -1.0, 1.0 ) + getRandomNumber( -1.0, 1.0 ) );
+  Statistic<double> stat;
+  stat.addValues( values.begin(), values.end() );
+  Histogram<double> hist;
+  hist.init( 32, stat );
+  hist.addValues( values.begin(), values.end() );
+  hist.terminate();
+
+  Histogram<double> chunked;
+  chunked.init( 32, stat );
+  chunked.addValues( values.begin(), values.end(), 5 );
+  chunked.terminate();
+
+  Histogram<double> first;
+  first.init( 32, stat );
+  first.addValues( values.begin(), values.begin() + 1234 );
+  Histogram<double> second;
+  second.init( 32, stat );
+  second.addValues( values.begin() + 1234, values.end() );
+  first.merge( second );
+  first.terminate();
+
+  bool same = chunked.size() == hist.size() && first.size() == hist.size();
+  for ( unsigned int i = 0; same && i < hist.size(); ++i )
+    same = chunked.nb( i ) == hist.nb( i ) && first.nb( i ) == hist.nb( i );
+  ++nb, nbok += ( same && chunked.area() == 10000 && first.area() == 10000 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "chunked and merged histograms have the same bins" << std::endl;
+  return nbok == nb;
+}
+
+bool testHistogramFewSamples()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  // No sample, one sample, or equal samples: a single bin.
+  Statistic<double> stat;
+  Histogram<double> empty;
+  empty.init( Histogram<double>::Scott, stat );
+  stat.addValue( 2.5 );
+  Histogram<double> one;
+  one.init( Histogram<double>::Scott, stat );
+  one.addValue( 2.5 );
+  one.terminate();
+  stat.addValue( 2.5 );
+  Histogram<double> equal;
+  equal.init( 16, stat );
+  ++nb, nbok += ( empty.size() == 1 && one.size() == 1 && one.cdf( 0 ) == 1.0
+                  && equal.size() == 1 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "histograms of less than two distinct samples" << std::endl;
+  return nbok == nb;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -119,7 +181,9 @@ int main( int, char** )
 
   bool res = testHistogramUniform()
     && testHistogramGaussian()
-    && testHistogramGaussian2();
+    && testHistogramGaussian2()
+    && testHistogramChunks()
+    && testHistogramFewSamples();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
 
   trace.endBlock();
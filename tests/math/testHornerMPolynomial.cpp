@@ -0,0 +1,127 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHornerMPolynomial.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class HornerMPolynomial.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/HornerMPolynomial.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HornerMPolynomial.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing HornerMPolynomial" )
+{
+  typedef Z3i::RealPoint RealPoint;
+  // Goursat-like surface x^4 + y^4 + z^4 - 2 x^2 y z + 3 z - 1.5
+  MPolynomial<3, double> P = mmonomial<double>( 4, 0, 0 )
+    + mmonomial<double>( 0, 4, 0 )
+    + mmonomial<double>( 0, 0, 4 )
+    - 2.0 * mmonomial<double>( 2, 1, 1 )
+    + 3.0 * mmonomial<double>( 0, 0, 1 )
+    - 1.5 * mmonomial<double>( 0, 0, 0 );
+  HornerMPolynomial<3, double> H( P );
+
+  std::vector<RealPoint> points;
+  for ( double x = -1.5; x <= 1.5; x += 0.37 )
+    for ( double y = -1.5; y <= 1.5; y += 0.41 )
+      for ( double z = -1.5; z <= 1.5; z += 0.43 )
+        points.push_back( RealPoint( x, y, z ) );
+
+  SECTION( "Pointwise evaluation is identical to MPolynomial evaluation" )
+    {
+      unsigned int nbOk = 0;
+      for ( auto p : points )
+        if ( H( p ) == Approx( P( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) ) ) nbOk++;
+      REQUIRE( nbOk == points.size() );
+    }
+
+  SECTION( "Batch evaluations are identical to pointwise evaluation" )
+    {
+      std::vector<double> values;
+      H.evaluate( points, values );
+      std::vector<double> values2;
+      H.evaluate( points.begin(), points.end(), std::back_inserter( values2 ) );
+      REQUIRE( values.size() == points.size() );
+      REQUIRE( values2.size() == points.size() );
+      unsigned int nbOk = 0;
+      for ( unsigned int i = 0; i < points.size(); ++i )
+        if ( ( values[ i ] == H( points[ i ] ) )
+             && ( values2[ i ] == H( points[ i ] ) ) ) nbOk++;
+      REQUIRE( nbOk == points.size() );
+    }
+
+  SECTION( "Zero and constant polynomials" )
+    {
+      HornerMPolynomial<3, double> Z;
+      HornerMPolynomial<3, double> C( MPolynomial<3, double>( 2.5 ) );
+      REQUIRE( Z.isValid() );
+      REQUIRE( Z( RealPoint( 1.0, 2.0, 3.0 ) ) == 0.0 );
+      REQUIRE( C( RealPoint( 1.0, 2.0, 3.0 ) ) == 2.5 );
+      REQUIRE( C.size() == 1 );
+    }
+
+  SECTION( "ImplicitPolynomial3Shape uses compiled polynomials" )
+    {
+      typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+      Shape shape( P );
+      MPolynomial<3, double> Fx = derivative<0>( P );
+      MPolynomial<3, double> Fy = derivative<1>( P );
+      MPolynomial<3, double> Fz = derivative<2>( P );
+      std::vector<double> values;
+      std::vector<Shape::RealVector> gradients;
+      shape.values( points, values );
+      shape.gradients( points, gradients );
+      unsigned int nbOk = 0;
+      for ( unsigned int i = 0; i < points.size(); ++i )
+        {
+          const RealPoint & p = points[ i ];
+          Shape::RealVector g = shape.gradient( p );
+          if ( ( shape( p ) == Approx( P( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) ) )
+               && ( values[ i ] == shape( p ) )
+               && ( g[ 0 ] == Approx( Fx( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) ) )
+               && ( g[ 1 ] == Approx( Fy( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) ) )
+               && ( g[ 2 ] == Approx( Fz( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) ) )
+               && ( gradients[ i ] == g ) )
+            nbOk++;
+        }
+      REQUIRE( nbOk == points.size() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -118,6 +118,55 @@ TEST_CASE( "Testing MultiStatistics" )
       REQUIRE( stats3.median(val) == ((val+1)/2) );            
     }
 
+  MultiStatistics first (2, true);
+  MultiStatistics second (2, true);
+  for(unsigned int j = 0; j< 10; j++)
+    {
+      first.addValue(0, j);
+      second.addValue(0, 10 - j);
+      second.addValue(1, j);
+    }
+  first.merge(second);
+  first.terminate();
+
+  SECTION("Testing merge of MultiStatistics")
+    {
+      REQUIRE( first.samples(0) == 20 );
+      REQUIRE( first.samples(1) == 10 );
+      REQUIRE( first.max(0) == 10 );
+      REQUIRE( first.maxIndice(0) == 10 );
+      REQUIRE( first.min(0) == 0 );
+      REQUIRE( first.minIndice(0) == 0 );
+      REQUIRE( first.mean(0) == 5.0 );
+      REQUIRE( first.value(0, 19) == 1.0 );
+      REQUIRE( first.minIndice(1) == 0 );
+      REQUIRE( first.max(1) == 9 );
+    }
+
+  // Values with a large offset: the variance is kept by merge.
+  MultiStatistics whole (1, false);
+  MultiStatistics left (1, false);
+  MultiStatistics right (1, false);
+  for(unsigned int j = 0; j< 100; j++)
+    {
+      const double v = 1e9 + ( j % 7 );
+      whole.addValue(0, v);
+      if ( j < 37 ) left.addValue(0, v);
+      else right.addValue(0, v);
+    }
+  left.merge(right);
+  whole.terminate();
+  left.terminate();
+
+  SECTION("Testing variance of merged MultiStatistics")
+    {
+      REQUIRE( whole.variance(0) > 3.9 );
+      REQUIRE( whole.variance(0) < 4.1 );
+      REQUIRE( left.samples(0) == 100 );
+      REQUIRE( std::abs( left.variance(0) - whole.variance(0) ) < 1e-6 );
+      REQUIRE( std::abs( left.unbiasedVariance(0) - whole.unbiasedVariance(0) ) < 1e-6 );
+    }
+
 
 }
 
@@ -100,6 +100,30 @@ TEST_CASE( "Testing Profile" )
       REQUIRE( y[0] == 2);
     }
 
+  SECTION("Testing merge of Profile")
+    {
+      Profile<> first(Profile<>::MAX);
+      Profile<> second(Profile<>::MAX);
+      first.init(2);
+      second.init(2);
+      first.addValue(0, 1);
+      first.addValue(1, 5);
+      second.addValue(0, 3);
+      second.addValue(1, 2);
+      first.merge(second);
+      std::vector<double> x;
+      std::vector<double> y;
+      first.getProfile(x, y);
+      REQUIRE( y[0] == 3 );
+      REQUIRE( y[1] == 5 );
+      first.setType(Profile<>::MEAN);
+      x.clear();
+      y.clear();
+      first.getProfile(x, y);
+      REQUIRE( y[0] == 2 );
+      REQUIRE( y[1] == 3.5 );
+    }
+
 }
 
 /** @ingroup Tests **/
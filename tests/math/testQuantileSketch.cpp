@@ -0,0 +1,106 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testQuantileSketch.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class QuantileSketch.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/math/QuantileSketch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class QuantileSketch.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing QuantileSketch" )
+{
+  // A permutation of 0..n-1, so that the exact q-quantile is about q*n.
+  const unsigned int n = 100000;
+  std::vector<unsigned int> values( n );
+  for ( unsigned int i = 0; i < n; ++i )
+    values[ i ] = (unsigned int) ( ( 7919ULL * i ) % n );
+
+  QuantileSketch<unsigned int> sketch;
+  sketch.addValues( values.begin(), values.end() );
+
+  SECTION("Testing quantiles of a sketch")
+    {
+      REQUIRE( sketch.isValid() );
+      REQUIRE( sketch.samples() == n );
+      REQUIRE( sketch.size() < 4 * sketch.k() );
+      REQUIRE( sketch.min() == 0 );
+      REQUIRE( sketch.max() == n - 1 );
+      REQUIRE( std::fabs( (double) sketch.median() - 0.5 * n ) < 0.02 * n );
+      REQUIRE( std::fabs( (double) sketch.quantile( 0.1 ) - 0.1 * n ) < 0.02 * n );
+      REQUIRE( std::fabs( (double) sketch.quantile( 0.9 ) - 0.9 * n ) < 0.02 * n );
+      REQUIRE( std::fabs( sketch.cdf( n / 4 ) - 0.25 ) < 0.02 );
+    }
+
+  SECTION("Testing merge and chunked additions")
+    {
+      QuantileSketch<unsigned int> first, second;
+      first.addValues( values.begin(), values.begin() + n / 3 );
+      second.addValues( values.begin() + n / 3, values.end() );
+      first.merge( second );
+      REQUIRE( first.isValid() );
+      REQUIRE( first.samples() == n );
+      REQUIRE( first.min() == 0 );
+      REQUIRE( first.max() == n - 1 );
+      REQUIRE( std::fabs( (double) first.median() - 0.5 * n ) < 0.02 * n );
+
+      QuantileSketch<unsigned int> chunked, chunked2;
+      chunked.addValues( values.begin(), values.end(), 8 );
+      chunked2.addValues( values.begin(), values.end(), 8 );
+      REQUIRE( chunked.isValid() );
+      REQUIRE( chunked.samples() == n );
+      REQUIRE( chunked.median() == chunked2.median() );
+      REQUIRE( std::fabs( (double) chunked.quantile( 0.75 ) - 0.75 * n ) < 0.02 * n );
+    }
+
+  SECTION("Testing small sketches")
+    {
+      QuantileSketch<double> small;
+      small.addValue( 3.0 );
+      small.addValue( 1.0 );
+      small.addValue( 2.0 );
+      REQUIRE( small.median() == 2.0 );
+      REQUIRE( small.quantile( 0.0 ) == 1.0 );
+      REQUIRE( small.quantile( 1.0 ) == 3.0 );
+      small.clear();
+      REQUIRE( small.empty() );
+      REQUIRE( small.isValid() );
+    }
+}
+
+/** @ingroup Tests **/
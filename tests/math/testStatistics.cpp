@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <cmath>
 #include "DGtal/math/Statistic.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -112,6 +113,68 @@ bool testStatisticsSaving()
   return nbok == nb;
 }
 
+/**
+ * Merging statistics, and filling them by chunks.
+ *
+ */
+bool testStatisticsMerge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Statistics merge ..." );
+
+  // Large offset: the sum of squares would lose all the digits of the variance.
+  std::vector<double> values;
+  for(unsigned int k=0; k < 10000; k++)
+    values.push_back( 1e9 + (double) ( k % 10 ) );
+
+  Statistic<double> stat;
+  stat.addValues( values.begin(), values.end() );
+  trace.info() << stat << std::endl;
+  nbok += ( std::fabs( stat.variance() - 8.25 ) < 1e-6 
+            && std::fabs( stat.unbiasedVariance() - 8.25 * 10000.0 / 9999.0 ) < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "variance of offset values = 8.25" << std::endl;
+
+  Statistic<double> first( true ), second( true );
+  first.addValues( values.begin(), values.begin() + 3333 );
+  second.addValues( values.begin() + 3333, values.end() );
+  first.merge( second );
+  nbok += ( first.samples() == stat.samples() && first.mean() == stat.mean()
+            && std::fabs( first.variance() - stat.variance() ) < 1e-6
+            && first.min() == stat.min() && first.max() == stat.max()
+            && first.median() == 1e9 + 5.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "merge of two halves: " << first << std::endl;
+
+  Statistic<double> chunked;
+  chunked.addValues( values.begin(), values.end(), 7 );
+  Statistic<double> chunked2;
+  chunked2.addValues( values.begin(), values.end(), 7 );
+  nbok += ( chunked.samples() == stat.samples()
+            && std::fabs( chunked.variance() - stat.variance() ) < 1e-6
+            && chunked.variance() == chunked2.variance() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "addValues by 7 chunks: " << chunked << std::endl;
+
+  Statistic<int> empty, ints;
+  ints.addValue( 3 );
+  ints.addValue( -1 );
+  empty += ints;
+  nbok += ( empty.samples() == 2 && empty.min() == -1 && empty.max() == 3 
+            && empty.variance() == 4.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "merge into an empty statistic" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -132,7 +195,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res2 = testStatisticsSaving(); // && ... other tests
+  bool res2 = testStatisticsSaving()
+    && testStatisticsMerge(); // && ... other tests
   trace.emphase() << ( res2 ? "Passed." : "Error." ) << endl;
 
 
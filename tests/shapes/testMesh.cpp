@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/writers/MeshWriter.h"
@@ -389,6 +390,127 @@ bool testVisualTubularMesh()
 
 }
 
+/**
+ * Test the flat face buffers and the half-edges on a cube.
+ */
+bool testMeshHalfEdges()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Mesh<Z3i::RealPoint> CubeMesh;
+
+  trace.beginBlock ( "Testing Mesh bulk faces and half-edges  ..." );
+  CubeMesh aMesh(true);
+  for(unsigned int i = 0; i < 8; i++)
+    {
+      aMesh.addVertex(Z3i::RealPoint(i%2, (i/2)%2, i/4));
+    }
+  // Each face is counterclockwise when seen from outside.
+  const unsigned int cube[24] = { 0, 2, 3, 1,  4, 5, 7, 6,  0, 1, 5, 4,
+                                  2, 6, 7, 3,  0, 4, 6, 2,  1, 3, 7, 5 };
+  std::vector<unsigned int> faceSizes(6, 4);
+  std::vector<unsigned int> indices(cube, cube+24);
+  std::vector<DGtal::Color> colors(6, DGtal::Color::Red);
+  colors[5] = DGtal::Color::Blue;
+  aMesh.addFaces(faceSizes, indices, colors);
+  nbok += ( aMesh.nbFaces() == 6 && aMesh.faceStarts().size() == 7 
+            && aMesh.faceIndices().size() == 24 && aMesh.getFace(5).at(2) == 7
+            && aMesh.getFaceColor(5) == DGtal::Color::Blue && aMesh.isValid() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << aMesh << std::endl;
+
+  bool okOpposites = aMesh.nbHalfEdges() == 24;
+  for(unsigned int h = 0; h < aMesh.nbHalfEdges(); h++)
+    {
+      const unsigned int o = aMesh.oppositeHalfEdge(h);
+      okOpposites = okOpposites && o != CubeMesh::invalidIndex() 
+        && aMesh.oppositeHalfEdge(o) == h
+        && aMesh.halfEdgeSource(o) == aMesh.halfEdgeTarget(h)
+        && aMesh.halfEdgeTarget(o) == aMesh.halfEdgeSource(h)
+        && aMesh.halfEdgeFace(o) != aMesh.halfEdgeFace(h)
+        && aMesh.previousHalfEdge(aMesh.nextHalfEdge(h)) == h;
+    }
+  nbok += okOpposites ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "each half-edge of the cube has an opposite" << std::endl;
+
+  // Reading faces keeps the half-edges, modifying a face rebuilds them.
+  const unsigned int h0 = aMesh.oppositeHalfEdge(0);
+  const CubeMesh & constMesh = aMesh;
+  bool okModify = constMesh.getFace(0).size() == 4 && aMesh.oppositeHalfEdge(0) == h0;
+  CubeMesh::FaceView face0 = aMesh.modifyFace(0);
+  std::swap(face0[1], face0[3]);
+  okModify = okModify && aMesh.oppositeHalfEdge(0) == CubeMesh::invalidIndex();
+  face0 = aMesh.modifyFace(0);
+  std::swap(face0[1], face0[3]);
+  okModify = okModify && aMesh.oppositeHalfEdge(0) == h0;
+  nbok += okModify ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "half-edges are rebuilt after modifyFace" << std::endl;
+
+  std::vector<unsigned int> neighbors;
+  bool okNeighbors = true;
+  for(unsigned int v = 0; v < 8; v++)
+    {
+      aMesh.vertexNeighbors(v, neighbors);
+      okNeighbors = okNeighbors && neighbors.size() == 3 
+        && aMesh.outgoingHalfEdges(v).size() == 3;
+    }
+  aMesh.faceNeighbors(0, neighbors);
+  okNeighbors = okNeighbors && neighbors.size() == 4 && neighbors[0] == 2 && neighbors[3] == 5;
+  nbok += okNeighbors ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3 neighbors per vertex, 4 per face" << std::endl;
+
+  // Concurrent adjacency queries on a copy build its half-edges once.
+  const CubeMesh copy( aMesh );
+  const long nbH = (long) copy.nbHalfEdges();
+  std::vector<unsigned int> opposites( nbH );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static,1)
+#endif
+  for(long h = 0; h < nbH; h++)
+    {
+      opposites[h] = copy.oppositeHalfEdge((unsigned int) h);
+    }
+  bool okConcurrent = true;
+  for(long h = 0; h < nbH; h++)
+    {
+      okConcurrent = okConcurrent && opposites[h] == aMesh.oppositeHalfEdge((unsigned int) h);
+    }
+  nbok += okConcurrent ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "concurrent adjacency queries" << std::endl;
+
+  // Removing the last face opens the cube.
+  std::vector<unsigned int> removed(1, 5);
+  aMesh.removeFaces(removed);
+  unsigned int nbBoundary = 0;
+  for(unsigned int h = 0; h < aMesh.nbHalfEdges(); h++)
+    {
+      nbBoundary += aMesh.oppositeHalfEdge(h) == CubeMesh::invalidIndex() ? 1 : 0;
+    }
+  nbok += ( aMesh.nbFaces() == 5 && aMesh.nbVertex() == 8 && nbBoundary == 4 
+            && aMesh.getFaceColor(4) == DGtal::Color::Red && aMesh.isValid() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbBoundary << " boundary half-edges after removing a face" << std::endl;
+
+  aMesh.setFaceColor(0, DGtal::Color::Green);
+  aMesh.quadToTriangularFaces();
+  aMesh.invertVertexFaceOrder();
+  nbBoundary = 0;
+  for(unsigned int h = 0; h < aMesh.nbHalfEdges(); h++)
+    {
+      nbBoundary += aMesh.oppositeHalfEdge(h) == CubeMesh::invalidIndex() ? 1 : 0;
+    }
+  nbok += ( aMesh.nbFaces() == 10 && aMesh.nbHalfEdges() == 30 && nbBoundary == 4
+            && aMesh.getFaceColor(1) == DGtal::Color::Green 
+            && aMesh.getFaceColor(2) == DGtal::Color::Red && aMesh.isValid() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "half-edges are rebuilt after triangulation" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -400,7 +522,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMesh() && testMeshGeneration() && testVisualTubularMesh(); 
+  bool res = testMesh() && testMeshGeneration() && testVisualTubularMesh()
+    && testMeshHalfEdges();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshHelpers.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MeshHelpers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MeshHelpers.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the Euler characteristic V - E + F of @a mesh.
+ */
+template <typename TPoint>
+int eulerCharacteristic( const Mesh<TPoint> & mesh )
+{
+  std::set< std::pair<unsigned int, unsigned int> > edges;
+  for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const typename Mesh<TPoint>::ConstFaceView face = mesh.getFace( f );
+      for ( unsigned int i = 0; i < face.size(); ++i )
+        {
+          unsigned int a = face[ i ];
+          unsigned int b = face[ ( i + 1 ) % face.size() ];
+          edges.insert( std::make_pair( std::min( a, b ), std::max( a, b ) ) );
+        }
+    }
+  return (int) mesh.nbVertex() - (int) edges.size() + (int) mesh.nbFaces();
+}
+
+/**
+ * @return the number of faces of @a mesh whose normal points away
+ * from @a center.
+ */
+template <typename TPoint>
+unsigned int nbOutwardFaces( const Mesh<TPoint> & mesh, const TPoint & center )
+{
+  unsigned int nb = 0;
+  for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const typename Mesh<TPoint>::ConstFaceView face = mesh.getFace( f );
+      const TPoint u = mesh.getVertex( face[ 1 ] ) - mesh.getVertex( face[ 0 ] );
+      const TPoint v = mesh.getVertex( face[ 2 ] ) - mesh.getVertex( face[ 1 ] );
+      TPoint n( u[ 1 ] * v[ 2 ] - u[ 2 ] * v[ 1 ],
+                u[ 2 ] * v[ 0 ] - u[ 0 ] * v[ 2 ],
+                u[ 0 ] * v[ 1 ] - u[ 1 ] * v[ 0 ] );
+      if ( n.dot( mesh.getFaceBarycenter( f ) - center ) > 0.0 ) ++nb;
+    }
+  return nb;
+}
+
+bool testMeshHelpers()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z3i::Point Point;
+  typedef Z3i::RealPoint RealPoint;
+  typedef Z3i::Domain Domain;
+  typedef Z3i::KSpace KSpace;
+  typedef DigitalSetBoundary<KSpace, Z3i::DigitalSet> Boundary;
+  typedef DigitalSurface<Boundary> Surface;
+
+  trace.beginBlock ( "Testing MeshHelpers on a ball ..." );
+  Domain domain( Point( -12, -12, -12 ), Point( 12, 12, 12 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Domain>::addNorm2Ball( set, Point( 0, 0, 0 ), 10 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Surface surface( new Boundary( K, set ) );
+
+  Clock c;
+  c.startClock();
+  Mesh<RealPoint> primal;
+  MeshHelpers::digitalSurface2PrimalMesh( surface, CanonicCellEmbedder<KSpace>( K ), primal );
+  const double t = c.stopClock();
+  nbok += ( primal.nbFaces() == surface.size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "primal mesh: " << primal.nbVertex() << " vertices, "
+               << primal.nbFaces() << " quads in " << t << " ms" << std::endl;
+  nbok += ( eulerCharacteristic( primal ) == 2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "pointels are welded: V-E+F = 2" << std::endl;
+  const unsigned int nbOut = nbOutwardFaces( primal, RealPoint( 0, 0, 0 ) );
+  nbok += ( nbOut == primal.nbFaces() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbOut << " quads oriented outward" << std::endl;
+  bool isPointel = true;
+  for ( unsigned int v = 0; v < primal.nbVertex(); ++v )
+    for ( Dimension i = 0; i < 3; ++i )
+      isPointel = isPointel
+        && ( primal.getVertex( v )[ i ] + 0.5 == std::floor( primal.getVertex( v )[ i ] + 0.5 ) );
+  nbok += isPointel ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vertices are at voxel corners" << std::endl;
+
+  Mesh<RealPoint> dual;
+  MeshHelpers::digitalSurface2DualMesh( surface, CanonicSCellEmbedder<KSpace>( K ), dual );
+  nbok += ( dual.nbVertex() == surface.size() )
+    && ( dual.nbFaces() == surface.allClosedFaces().size() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "dual mesh: " << dual.nbVertex() << " vertices, "
+               << dual.nbFaces() << " faces" << std::endl;
+  nbok += ( eulerCharacteristic( dual ) == 2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "dual mesh: V-E+F = 2" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing MeshHelpers in a periodic space ..." );
+  // A slab of a space periodic along x and y: its boundary is made of
+  // two tori, whose pointels across the periodic bounds are welded.
+  Domain slabDomain( Point( -4, -4, -4 ), Point( 4, 4, 4 ) );
+  Z3i::DigitalSet slab( slabDomain );
+  for ( Domain::ConstIterator it = slabDomain.begin(), itE = slabDomain.end(); it != itE; ++it )
+    if ( std::abs( (*it)[ 2 ] ) <= 2 ) slab.insertNew( *it );
+  KSpace periodicK;
+  periodicK.init( slabDomain.lowerBound(), slabDomain.upperBound(),
+                  {{ KSpace::PERIODIC, KSpace::PERIODIC, KSpace::CLOSED }} );
+  Surface slabSurface( new Boundary( periodicK, slab ) );
+  Mesh<RealPoint> slabPrimal;
+  MeshHelpers::digitalSurface2PrimalMesh( slabSurface, CanonicCellEmbedder<KSpace>( periodicK ),
+                                          slabPrimal );
+  nbok += ( slabPrimal.nbFaces() == 2 * 9 * 9 )
+    && ( slabPrimal.nbVertex() == slabPrimal.nbFaces() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "periodic primal mesh: " << slabPrimal.nbVertex() << " vertices, "
+               << slabPrimal.nbFaces() << " quads" << std::endl;
+  nbok += ( eulerCharacteristic( slabPrimal ) == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "pointels are welded across the periodic bounds: V-E+F = 0" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing MeshHelpers::weldKeys ..." );
+  std::vector<DGtal::uint64_t> keys;
+  for ( unsigned int i = 0; i < 100000; ++i )
+    keys.push_back( ( (DGtal::uint64_t) i * 7919 ) % 30011 );
+  std::vector<std::size_t> ids, firsts;
+  const std::size_t n = MeshHelpers::weldKeys( keys, ids, firsts );
+  bool ok = ( n == 30011 ) && ( firsts.size() == n );
+  for ( std::size_t i = 0; ok && i < keys.size(); ++i )
+    ok = ( ids[ i ] < n ) && ( keys[ firsts[ ids[ i ] ] ] == keys[ i ] )
+      && ( firsts[ ids[ i ] ] <= i );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << n << " distinct keys among " << keys.size() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MeshHelpers" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMeshHelpers();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
 #include "DGtal/topology/ExplicitDigitalSurface.h"
 #include "DGtal/topology/LightExplicitDigitalSurface.h"
+#include "DGtal/topology/SetOfSurfels.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/topology/helpers/FrontierPredicate.h"
 #include "DGtal/topology/helpers/BoundaryPredicate.h"
@@ -585,6 +586,109 @@ bool testDigitalSurface()
   return nbok == nb;
 }
 
+/**
+ * Checks allFaces, allClosedFaces, allOpenFaces and
+ * computeIndexedFaces against the faces found from every vertex.
+ */
+template <typename MyDS>
+bool checkFaces( const MyDS & digsurf, unsigned int & nbok, unsigned int & nb )
+{
+  typedef typename MyDS::FaceSet FaceSet;
+  typedef typename MyDS::FaceRange FaceRange;
+  typedef typename MyDS::VertexRange VertexRange;
+  typedef typename MyDS::IndexedFaces IndexedFaces;
+  FaceSet all, closed, open;
+  for ( typename MyDS::ConstIterator it = digsurf.begin(), itE = digsurf.end();
+        it != itE; ++it )
+    {
+      FaceRange faces = digsurf.facesAroundVertex( *it );
+      for ( typename FaceRange::const_iterator itf = faces.begin(), itfE = faces.end();
+            itf != itfE; ++itf )
+        {
+          all.insert( *itf );
+          if ( itf->isClosed() ) closed.insert( *itf );
+          else open.insert( *itf );
+        }
+    }
+  nb++, nbok += ( digsurf.allFaces() == all ) ? 1 : 0;
+  nb++, nbok += ( digsurf.allClosedFaces() == closed ) ? 1 : 0;
+  nb++, nbok += ( digsurf.allOpenFaces() == open ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "#faces=" << all.size() << " #closed=" << closed.size()
+               << " #open=" << open.size() << std::endl;
+  IndexedFaces indexed;
+  digsurf.computeIndexedFaces( indexed, true, true );
+  bool ok = ( indexed.vertices.size() == digsurf.size() )
+    && ( indexed.nbFaces() == all.size() )
+    && std::equal( all.begin(), all.end(), indexed.faces.begin() );
+  for ( std::size_t f = 0; ok && f < indexed.nbFaces(); ++f )
+    {
+      VertexRange vtcs = digsurf.verticesAroundFace( indexed.faces[ f ] );
+      ok = ( vtcs.size() == indexed.nbVertices( f ) );
+      for ( std::size_t i = 0; ok && i < vtcs.size(); ++i )
+        ok = indexed.vertices[ indexed.faceVertices[ indexed.faceStarts[ f ] + i ] ] == vtcs[ i ];
+    }
+  nb++, nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "computeIndexedFaces matches verticesAroundFace" << std::endl;
+  return ok;
+}
+
+template <typename KSpace>
+bool testDigitalSurfaceFaces()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  std::string msg( "Testing faces of DigitalSurface in K" );
+  msg += '0' + KSpace::dimension;
+  trace.beginBlock ( msg );
+  typedef typename KSpace::Space Space;
+  typedef typename Space::Point Point;
+  typedef typename KSpace::Surfel Surfel;
+  typedef typename KSpace::SurfelSet SurfelSet;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector < Domain, BIG_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type DigitalSet;
+  const int r = ( KSpace::dimension == 3 ) ? 6 : 3;
+  Point p0 = Point::diagonal( 0 );
+  Domain domain( Point::diagonal( -r-2 ), Point::diagonal( r+2 ) );
+  DigitalSet dig_set( domain );
+  Shapes<Domain>::addNorm2Ball( dig_set, p0, r );
+  Shapes<Domain>::removeNorm2Ball( dig_set, p0, 1 );
+  // Some non well-composed configurations.
+  Point p = Point::diagonal( 0 ); p[ 0 ] = r+1;
+  dig_set.insertNew( p );
+  p[ 1 ] = 1; p[ 0 ] = -r-1;
+  dig_set.insertNew( p );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  trace.beginBlock ( "Closed surface (DigitalSetBoundary)" );
+  typedef DigitalSetBoundary<KSpace,DigitalSet> DSContainer;
+  typedef DigitalSurface<DSContainer> MyDS;
+  MyDS digsurf( new DSContainer( K, dig_set ) );
+  checkFaces( digsurf, nbok, nb );
+  trace.endBlock();
+
+  trace.beginBlock ( "Open surface (half of the previous one, SetOfSurfels)" );
+  typedef SurfelAdjacency<KSpace::dimension> MySurfelAdjacency;
+  typedef SetOfSurfels<KSpace, SurfelSet> SOSContainer;
+  typedef DigitalSurface<SOSContainer> MyOpenDS;
+  MySurfelAdjacency surfAdj( true );
+  SurfelSet half;
+  for ( typename MyDS::ConstIterator it = digsurf.begin(), itE = digsurf.end();
+        it != itE; ++it )
+    {
+      Surfel s = *it;
+      if ( K.sKCoords( s )[ 0 ] >= 0 ) half.insert( s );
+    }
+  MyOpenDS opensurf( new SOSContainer( K, surfAdj, half ) );
+  checkFaces( opensurf, nbok, nb );
+  trace.endBlock();
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -603,7 +707,9 @@ int main( int argc, char** argv )
     && testLightExplicitDigitalSurface()
     && testDigitalSurface<KhalimskySpaceND<2> >()
     && testDigitalSurface<KhalimskySpaceND<3> >()
-    && testDigitalSurface<KhalimskySpaceND<4> >();
+    && testDigitalSurface<KhalimskySpaceND<4> >()
+    && testDigitalSurfaceFaces<KhalimskySpaceND<3> >()
+    && testDigitalSurfaceFaces<KhalimskySpaceND<4> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;